@@ -0,0 +1,574 @@
+//Monte-Carlo combat simulator, for balancing and regression checking weapons and monsters.
+//Build with "make combat-sim" (and run it from a directory with the game data).
+//
+//Two monsters are put on a walled in scratch map, and fight until one of them dies (or
+//the turn limit is reached). The duels are run on several threads, each with its own game
+//session, with the message log disabled and without rendering. The outcomes, the number of
+//attacker turns until the defender was killed, and the throughput are printed.
+//
+//Usage: ia_combat_sim --attacker MON --defender MON [--wpn ITEM] [--dist N] [--duels N]
+//                     [--threads N] [--max-turns N] [--seed N] [--list]
+//
+//  --attacker MON  The attacking monster (id number, or name such as "ghoul")
+//  --defender MON  The defending monster
+//  --wpn ITEM      Weapon always used by the attacker, instead of its own attacks (id number,
+//                  or name such as "pistol") - ranged weapons have unlimited ammo
+//  --dist N        Distance between the duelists at the start (default 1, at most 16)
+//  --duels N       Total number of duels (default 10000)
+//  --threads N     Number of threads (default is the number of CPUs)
+//  --max-turns N   Number of standard turns before a duel is a draw (default 1000)
+//  --seed N        Random seed of the first thread (the others use the following numbers)
+//  --list          Print the names of all monsters and items, and exit
+//
+//The duelists do not move, except towards each other when they cannot attack. The player
+//cannot take part in a duel (it is kept out of the way) - use a monster with "--wpn" to
+//check a player weapon.
+
+#include "init.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "config.hpp"
+#include "map.hpp"
+#include "actor_factory.hpp"
+#include "actor_mon.hpp"
+#include "actor_player.hpp"
+#include "item_factory.hpp"
+#include "item.hpp"
+#include "inventory.hpp"
+#include "feature_rigid.hpp"
+#include "game_time.hpp"
+#include "attack.hpp"
+#include "msg_log.hpp"
+#include "utils.hpp"
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+//The arena is an open rectangle on the scratch map, surrounded by walls
+const int ARENA_X0  = 10;
+const int ARENA_Y0  = 5;
+const int ARENA_W   = 20;
+const int ARENA_H   = 9;
+const int MAX_DIST  = ARENA_W - 4;
+
+const int AWARE_TURNS = 9999;
+
+struct Sim_params
+{
+    Actor_id        attacker_id;
+    Actor_id        defender_id;
+    Item_id         wpn_id;
+    int             dist;
+    int             nr_duels;
+    int             max_turns;
+    unsigned long   seed;
+};
+
+struct Thread_result
+{
+    const Sim_params*   params;
+    unsigned long       seed;
+    int                 nr_duels;
+
+    int                 nr_wins, nr_losses, nr_draws;
+    long long           nr_attacks;
+
+    //Number of attacker turns until the defender was killed, for each won duel
+    std::vector<int>    kill_turns;
+};
+
+std::string normalized_name(const std::string& name)
+{
+    std::string result = "";
+
+    for (char c : name)
+    {
+        if (c >= 'A' && c <= 'Z')
+        {
+            c = c - 'A' + 'a';
+        }
+
+        const bool IS_ALNUM = (c >= 'a' && c <= 'z') || (c >= '0' && c <= '9');
+
+        if (IS_ALNUM)
+        {
+            result += c;
+        }
+        else if (!result.empty() && result.back() != '_')
+        {
+            result += '_';
+        }
+    }
+
+    while (!result.empty() && result.back() == '_')
+    {
+        result.pop_back();
+    }
+
+    if (result.compare(0, 4, "the_") == 0)
+    {
+        result.erase(0, 4);
+    }
+
+    return result;
+}
+
+std::string actor_name(const int ID)
+{
+    return normalized_name(actor_data::data[ID].name_the);
+}
+
+std::string item_name(const int ID)
+{
+    return normalized_name(item_data::data[ID].base_name.names[int(Item_ref_type::plain)]);
+}
+
+//Returns the id given by number or by name, or -1 if there is no such id
+int parse_id(const std::string& str, const int NR_IDS, std::string (*name_of)(const int))
+{
+    if (!str.empty() && str.find_first_not_of("0123456789") == std::string::npos)
+    {
+        const int ID = atoi(str.c_str());
+
+        return ID < NR_IDS ? ID : -1;
+    }
+
+    const std::string name = normalized_name(str);
+
+    for (int i = 0; i < NR_IDS; ++i)
+    {
+        if (name_of(i) == name)
+        {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+void mk_arena()
+{
+    for (int x = ARENA_X0; x < ARENA_X0 + ARENA_W; ++x)
+    {
+        for (int y = ARENA_Y0; y < ARENA_Y0 + ARENA_H; ++y)
+        {
+            Cell& cell = map::cells[x][y];
+
+            delete cell.item;
+            cell.item = nullptr;
+
+            //Features may have been changed by the fight (e.g. burnt), so they are all put
+            //back for each duel
+            map::put(new Floor(Pos(x, y)));
+        }
+    }
+}
+
+//Makes an attack, or steps towards the opponent if no attack is possible. Returns true if
+//an attack was made.
+bool act(Mon& mon, Actor& opponent, Wpn* const wpn)
+{
+    //Always aware of the opponent
+    mon.aware_counter_ = AWARE_TURNS;
+
+    if (wpn)
+    {
+        const bool IS_ADJ = utils::is_pos_adj(mon.pos, opponent.pos, false);
+
+        if (IS_ADJ && wpn->data().melee.is_melee_wpn)
+        {
+            attack::melee(&mon, mon.pos, opponent, *wpn);
+            return true;
+        }
+
+        if (!IS_ADJ && wpn->data().ranged.is_ranged_wpn)
+        {
+            wpn->nr_ammo_loaded_ = wpn->data().ranged.max_ammo;
+
+            if (attack::ranged(&mon, mon.pos, opponent.pos, *wpn))
+            {
+                return true;
+            }
+        }
+    }
+    else if (mon.try_attack(opponent))
+    {
+        return true;
+    }
+
+    const Pos d = opponent.pos - mon.pos;
+
+    mon.move(dir_utils::dir(d.signs()));
+
+    return false;
+}
+
+int run_duels(void* data)
+{
+    auto* const result = static_cast<Thread_result*>(data);
+
+    const Sim_params& params = *result->params;
+
+    init::init_session();
+
+    msg_log::set_enabled(false);
+
+    rnd::seed(result->seed);
+
+    //The scratch map - outside the dungeon levels, monsters are not spawned as time passes
+    map::dlvl = 0;
+
+    map::reset_map();
+
+    //Keep the player walled in, out of sight of the duel
+    map::player->pos = Pos(1, 1);
+
+    map::put(new Floor(map::player->pos));
+
+    const int       Y           = ARENA_Y0 + (ARENA_H / 2);
+    const Pos       attacker_pos(ARENA_X0 + 2, Y);
+    const Pos       defender_pos(attacker_pos.x + params.dist, Y);
+
+    for (int i = 0; i < result->nr_duels; ++i)
+    {
+        mk_arena();
+
+        game_time::reset_turn_type_and_actor_counters();
+
+        Actor* const attacker_actor = actor_factory::mk(params.attacker_id, attacker_pos);
+        Actor* const defender_actor = actor_factory::mk(params.defender_id, defender_pos);
+
+        Mon& attacker = *static_cast<Mon*>(attacker_actor);
+        Mon& defender = *static_cast<Mon*>(defender_actor);
+
+        //Both are aware of each other from the start (no sneak attacks)
+        attacker.aware_counter_ = defender.aware_counter_ = AWARE_TURNS;
+
+        Wpn* wpn = nullptr;
+
+        if (params.wpn_id != Item_id::END)
+        {
+            wpn = static_cast<Wpn*>(item_factory::mk(params.wpn_id));
+
+            attacker.inv().put_in_slot(Slot_id::wielded, wpn);
+        }
+
+        const int START_TURN = game_time::turn();
+
+        int nr_attacker_turns = 0;
+
+        while (
+            attacker.is_alive()                                 &&
+            defender.is_alive()                                 &&
+            game_time::turn() - START_TURN < params.max_turns)
+        {
+            Actor* const cur = game_time::cur_actor();
+
+            if (cur == &attacker)
+            {
+                ++nr_attacker_turns;
+
+                if (act(attacker, defender, wpn))
+                {
+                    ++result->nr_attacks;
+                }
+            }
+            else if (cur == &defender)
+            {
+                act(defender, attacker, nullptr);
+            }
+            else //Player, or anything else
+            {
+                game_time::tick();
+            }
+        }
+
+        if (!defender.is_alive())
+        {
+            ++result->nr_wins;
+            result->kill_turns.push_back(nr_attacker_turns);
+        }
+        else if (!attacker.is_alive())
+        {
+            ++result->nr_losses;
+        }
+        else //Turn limit reached
+        {
+            ++result->nr_draws;
+        }
+
+        actor_factory::delete_all_mon();
+
+        game_time::erase_all_mobs();
+    }
+
+    mk_arena();
+
+    init::cleanup_session();
+
+    return 0;
+}
+
+int percentile(const std::vector<int>& sorted, const double PCT)
+{
+    const size_t RANK = size_t(PCT / 100.0 * sorted.size() + 0.999999);
+
+    return sorted[std::max(size_t(1), std::min(RANK, sorted.size())) - 1];
+}
+
+void print_list()
+{
+    printf("Monsters:\n");
+
+    //The player is not included (it cannot take part in duels)
+    for (int i = int(Actor_id::player) + 1; i < int(Actor_id::END); ++i)
+    {
+        printf("  %4d  %s\n", i, actor_name(i).c_str());
+    }
+
+    printf("Items:\n");
+
+    for (int i = 0; i < int(Item_id::END); ++i)
+    {
+        printf("  %4d  %s\n", i, item_name(i).c_str());
+    }
+}
+
+} //namespace
+
+int main(int argc, char* argv[])
+{
+    std::string attacker_str    = "";
+    std::string defender_str    = "";
+    std::string wpn_str         = "";
+    int         nr_threads      = 0;
+    bool        is_list         = false;
+
+    Sim_params params;
+
+    params.attacker_id  = Actor_id::END;
+    params.defender_id  = Actor_id::END;
+    params.wpn_id       = Item_id::END;
+    params.dist         = 1;
+    params.nr_duels     = 10000;
+    params.max_turns    = 1000;
+    params.seed         = 1;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+
+        const bool HAS_VAL = i + 1 < argc;
+
+        if (arg == "--attacker" && HAS_VAL)
+        {
+            attacker_str = argv[++i];
+        }
+        else if (arg == "--defender" && HAS_VAL)
+        {
+            defender_str = argv[++i];
+        }
+        else if (arg == "--wpn" && HAS_VAL)
+        {
+            wpn_str = argv[++i];
+        }
+        else if (arg == "--dist" && HAS_VAL)
+        {
+            params.dist = std::max(1, std::min(MAX_DIST, atoi(argv[++i])));
+        }
+        else if (arg == "--duels" && HAS_VAL)
+        {
+            params.nr_duels = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--threads" && HAS_VAL)
+        {
+            nr_threads = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--max-turns" && HAS_VAL)
+        {
+            params.max_turns = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--seed" && HAS_VAL)
+        {
+            params.seed = strtoul(argv[++i], nullptr, 10);
+        }
+        else if (arg == "--list")
+        {
+            is_list = true;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    config::init();
+
+    //No delays for animations, no waiting for key presses
+    if (!config::is_bot_playing())
+    {
+        config::toggle_bot_playing();
+    }
+
+    init::init_game();
+
+    //The data tables are needed on this thread for looking up the names
+    init::init_session();
+
+    if (is_list)
+    {
+        print_list();
+
+        init::cleanup_session();
+        init::cleanup_game();
+
+        return 0;
+    }
+
+    const int ATTACKER_ID   = parse_id(attacker_str, int(Actor_id::END), actor_name);
+    const int DEFENDER_ID   = parse_id(defender_str, int(Actor_id::END), actor_name);
+    const int WPN_ID        = wpn_str.empty() ?
+                              int(Item_id::END) :
+                              parse_id(wpn_str, int(Item_id::END), item_name);
+
+    if (
+        ATTACKER_ID <= int(Actor_id::player) ||
+        DEFENDER_ID <= int(Actor_id::player) ||
+        WPN_ID < 0)
+    {
+        fprintf(stderr, "Unknown or missing monster or weapon (see --list)\n");
+        return 1;
+    }
+
+    if (WPN_ID != int(Item_id::END))
+    {
+        const Item_type wpn_type = item_data::data[WPN_ID].type;
+
+        if (wpn_type != Item_type::melee_wpn && wpn_type != Item_type::ranged_wpn)
+        {
+            fprintf(stderr, "Not a weapon: %s\n", item_name(WPN_ID).c_str());
+            return 1;
+        }
+    }
+
+    params.attacker_id  = Actor_id(ATTACKER_ID);
+    params.defender_id  = Actor_id(DEFENDER_ID);
+    params.wpn_id       = Item_id(WPN_ID);
+
+    const std::string attacker_name = actor_name(ATTACKER_ID);
+    const std::string defender_name = actor_name(DEFENDER_ID);
+    const std::string wpn_name      = WPN_ID == int(Item_id::END) ? "" : item_name(WPN_ID);
+
+    init::cleanup_session();
+
+    if (nr_threads == 0)
+    {
+        nr_threads = std::max(1, SDL_GetCPUCount());
+    }
+
+    nr_threads = std::min(nr_threads, params.nr_duels);
+
+    std::vector<Thread_result>  results(nr_threads);
+    std::vector<SDL_Thread*>    threads(nr_threads, nullptr);
+
+    const auto start_time = Clock::now();
+
+    for (int i = 0; i < nr_threads; ++i)
+    {
+        Thread_result& r = results[i];
+
+        r.params        = &params;
+        r.seed          = params.seed + i;
+        r.nr_duels      = (params.nr_duels / nr_threads) + (i < params.nr_duels % nr_threads);
+        r.nr_wins       = 0;
+        r.nr_losses     = 0;
+        r.nr_draws      = 0;
+        r.nr_attacks    = 0;
+
+        threads[i] = SDL_CreateThread(run_duels, "combat_sim", &r);
+
+        if (!threads[i])
+        {
+            fprintf(stderr, "Failed to create thread: %s\n", SDL_GetError());
+            return 1;
+        }
+    }
+
+    Thread_result total;
+
+    total.nr_wins       = 0;
+    total.nr_losses     = 0;
+    total.nr_draws      = 0;
+    total.nr_attacks    = 0;
+
+    for (int i = 0; i < nr_threads; ++i)
+    {
+        SDL_WaitThread(threads[i], nullptr);
+
+        const Thread_result& r = results[i];
+
+        total.nr_wins       += r.nr_wins;
+        total.nr_losses     += r.nr_losses;
+        total.nr_draws      += r.nr_draws;
+        total.nr_attacks    += r.nr_attacks;
+
+        total.kill_turns.insert(end(total.kill_turns), begin(r.kill_turns), end(r.kill_turns));
+    }
+
+    const double SECS = std::chrono::duration<double>(Clock::now() - start_time).count();
+
+    init::cleanup_game();
+
+    printf("%s vs %s", attacker_name.c_str(), defender_name.c_str());
+
+    if (!wpn_name.empty())
+    {
+        printf(" (attacker uses %s)", wpn_name.c_str());
+    }
+
+    printf(", distance %d, %d duels on %d threads\n\n", params.dist, params.nr_duels, nr_threads);
+
+    const double DUELS_PCT = 100.0 / params.nr_duels;
+
+    printf("attacker wins   %8d (%5.1f%%)\n", total.nr_wins,   total.nr_wins   * DUELS_PCT);
+    printf("defender wins   %8d (%5.1f%%)\n", total.nr_losses, total.nr_losses * DUELS_PCT);
+    printf("draws           %8d (%5.1f%%)\n", total.nr_draws,  total.nr_draws  * DUELS_PCT);
+
+    std::vector<int>& kill_turns = total.kill_turns;
+
+    if (!kill_turns.empty())
+    {
+        std::sort(begin(kill_turns), end(kill_turns));
+
+        long long sum = 0;
+
+        for (const int T : kill_turns)
+        {
+            sum += T;
+        }
+
+        printf("\nattacker turns to kill the defender:\n");
+        printf("  mean %.2f, median %d, p90 %d, p99 %d, max %d\n",
+               double(sum) / kill_turns.size(),
+               percentile(kill_turns, 50.0),
+               percentile(kill_turns, 90.0),
+               percentile(kill_turns, 99.0),
+               kill_turns.back());
+    }
+
+    printf("\n%.2f s, %.0f duels/s, %.0f attacker attacks/s\n",
+           SECS, params.nr_duels / SECS, total.nr_attacks / SECS);
+
+    return 0;
+}
@@ -0,0 +1,601 @@
+//Benchmarks for the engine hot paths. Build and run with "make bench".
+//
+//Each benchmark is run a number of times untimed (warmup), then a number of timed
+//repetitions. The median and 99th percentile times are printed, and optionally written to
+//a JSON file, so that runs before and after an optimization can be compared.
+//
+//Usage: ia_bench [--json FILE] [--reps N] [--warmup N] [--filter TEXT] [--no-render]
+//
+//  --json FILE     Also write the results to FILE, in JSON format
+//  --reps N        Number of timed repetitions (overrides the default of each benchmark)
+//  --warmup N      Number of untimed runs before the timed repetitions (default 3)
+//  --filter TEXT   Only run the benchmarks with TEXT in their name
+//  --no-render     Do not set up rendering (the drawing benchmarks are then skipped)
+//
+//If built with ALLOC_TRACKING defined, the game object allocations of each benchmark are
+//also printed.
+
+#include "init.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <SDL.h>
+
+#include "sdl_wrapper.hpp"
+#include "config.hpp"
+#include "render.hpp"
+#include "map.hpp"
+#include "map_gen.hpp"
+#include "map_parsing.hpp"
+#include "actor_player.hpp"
+#include "feature_rigid.hpp"
+#include "fov.hpp"
+#include "explosion.hpp"
+#include "save_handling.hpp"
+#include "utils.hpp"
+#include "alloc_tracking.hpp"
+#include "actor_factory.hpp"
+#include "actor_mon.hpp"
+#include "game_time.hpp"
+#include "perception.hpp"
+#include "sim_lod.hpp"
+#include "map_gen_stats.hpp"
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+const unsigned long LVL_SEED = 1234;
+
+struct Bench_case
+{
+    const char* name;
+    int         nr_reps;
+
+    void        (*setup)();     //Called once before the warmup runs (may be null)
+    void        (*prepare)();   //Called before each run, not timed (may be null)
+    void        (*run)();
+};
+
+struct Bench_result
+{
+    std::string name;
+    int         nr_reps;
+    double      min_us, median_us, p99_us, max_us, mean_us;
+};
+
+bool            is_render_inited_ = false;
+
+bool            blocked_[MAP_W][MAP_H];
+bool            blocked_los_[MAP_W][MAP_H];
+bool            parse_out_[MAP_W][MAP_H];
+int             flood_[MAP_W][MAP_H];
+Los_result      fov_[MAP_W][MAP_H];
+std::vector<Pos> path_;
+Pos             path_tgt_;
+
+//---------------------------------------------------------------- SETUP
+void mk_bench_lvl()
+{
+    rnd::seed(LVL_SEED);
+
+    map::dlvl = 1;
+
+    while (!map_gen::mk_std_lvl()) {}
+
+    map_parse::run(cell_check::Blocks_move_cmn(false), blocked_);
+    map_parse::run(cell_check::Blocks_los(), blocked_los_);
+
+    map::player->update_fov();
+}
+
+void setup_path_find()
+{
+    mk_bench_lvl();
+
+    //Use the reachable cell furthest away from the player as target
+    flood_fill::run(map::player->pos, blocked_, flood_, INT_MAX, Pos(-1, -1), true);
+
+    path_tgt_ = map::player->pos;
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            if (flood_[x][y] > flood_[path_tgt_.x][path_tgt_.y])
+            {
+                path_tgt_ = Pos(x, y);
+            }
+        }
+    }
+}
+
+void setup_explosion()
+{
+    //An open area, with the player out of the blast radius
+    map::reset_map();
+
+    for (int x = 1; x < MAP_W - 1; ++x)
+    {
+        for (int y = 1; y < MAP_H - 1; ++y)
+        {
+            map::put(new Floor(Pos(x, y)));
+        }
+    }
+
+    map::player->pos = Pos(1, 1);
+}
+
+void setup_perception()
+{
+    mk_bench_lvl();
+
+    //A crowded level - put a monster on every fourth free cell, every other one allied to
+    //the player
+    int nr_free = 0;
+    int nr_mon  = 0;
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            const Pos p(x, y);
+
+            if (!blocked_[x][y] && p != map::player->pos && !utils::actor_at_pos(p))
+            {
+                if (nr_free++ % 4 == 0)
+                {
+                    Mon* const mon = static_cast<Mon*>(actor_factory::mk(Actor_id::rat, p));
+
+                    if (nr_mon++ % 2 == 0)
+                    {
+                        mon->leader_ = map::player;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void setup_mon_turns()
+{
+    mk_bench_lvl();
+
+    //Only rats, so that no monster can start shooting at the player
+    actor_factory::delete_all_mon();
+
+    //A crowded level, with the monsters out of the player's wake distance
+    int     nr_free = 0;
+    int     nr_mon  = 0;
+    Mon*    leader  = nullptr;
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            const Pos p(x, y);
+
+            if (
+                !blocked_[x][y]                                             &&
+                utils::king_dist(p, map::player->pos) > sim_lod::WAKE_DIST  &&
+                !utils::actor_at_pos(p))
+            {
+                if (nr_free++ % 4 == 0)
+                {
+                    Mon* const mon = static_cast<Mon*>(actor_factory::mk(Actor_id::rat, p));
+
+                    //In groups, as when monsters are spawned on a level
+                    if (nr_mon++ % 4 == 0)
+                    {
+                        leader = mon;
+                    }
+                    else
+                    {
+                        mon->leader_ = leader;
+                    }
+                }
+            }
+        }
+    }
+}
+
+void set_mon_detail(const int NR_TURNS_FULL_DETAIL)
+{
+    for (Actor* const actor : game_time::actors_)
+    {
+        if (!actor->is_player())
+        {
+            static_cast<Mon*>(actor)->nr_turns_full_detail_ = NR_TURNS_FULL_DETAIL;
+        }
+    }
+}
+
+void prepare_mon_turns()
+{
+    set_mon_detail(0);
+}
+
+void prepare_mon_turns_full_detail()
+{
+    set_mon_detail(sim_lod::NR_TURNS_WOKEN);
+}
+
+void prepare_load()
+{
+    //Loading empties the save file, so save the current game again first
+    save_handling::save();
+
+    //Loading is done into a fresh session, as when loading from the main menu
+    init::cleanup_session();
+    init::init_session();
+}
+
+//---------------------------------------------------------------- BENCHMARKS
+void run_fov()
+{
+    fov::run(map::player->pos, blocked_los_, fov_);
+}
+
+void run_flood_fill()
+{
+    flood_fill::run(map::player->pos, blocked_, flood_, INT_MAX, Pos(-1, -1), true);
+}
+
+void run_path_find()
+{
+    path_find::run(map::player->pos, path_tgt_, blocked_, path_);
+}
+
+void run_map_parse()
+{
+    map_parse::run(cell_check::Blocks_move_cmn(false), parse_out_);
+}
+
+void run_map_parse_expand()
+{
+    map_parse::expand(blocked_, parse_out_);
+}
+
+void run_map_parse_expand_dist()
+{
+    map_parse::expand(blocked_, parse_out_, 3);
+}
+
+void run_mk_std_lvl()
+{
+    map::dlvl = 1;
+
+    while (!map_gen::mk_std_lvl()) {}
+}
+
+void run_explosion()
+{
+    explosion::run_explosion_at(Pos(MAP_W_HALF, MAP_H_HALF), Expl_type::expl,
+                                Expl_src::misc, Emit_expl_snd::no);
+}
+
+//All monsters looking for foes, as on one turn phase
+void run_perception()
+{
+    perception::invalidate();
+
+    std::vector<Actor*> seen;
+
+    for (Actor* const actor : game_time::actors_)
+    {
+        if (!actor->is_player())
+        {
+            actor->seen_foes(seen);
+        }
+    }
+}
+
+//One round of actor turns, starting and ending with the player
+void run_mon_turns()
+{
+    do
+    {
+        Actor* const actor = game_time::cur_actor();
+
+        if (actor->is_player())
+        {
+            game_time::tick();
+        }
+        else
+        {
+            actor->on_actor_turn();
+        }
+    }
+    while (!game_time::cur_actor()->is_player());
+}
+
+void run_draw_map()
+{
+    render::draw_map();
+}
+
+void run_draw_map_and_interface()
+{
+    render::draw_map_and_interface();
+}
+
+void run_save()
+{
+    save_handling::save();
+}
+
+void run_load()
+{
+    save_handling::load();
+}
+
+void run_init_session()
+{
+    init::cleanup_session();
+    init::init_session();
+}
+
+//NOTE: The order matters - e.g. "explosion" replaces the map
+const Bench_case bench_cases_[] =
+{
+    {"fov",                     2000,   mk_bench_lvl,       nullptr,                         run_fov},
+    {"flood_fill",              2000,   mk_bench_lvl,       nullptr,                         run_flood_fill},
+    {"path_find",               500,    setup_path_find,    nullptr,                         run_path_find},
+    {"map_parse_run",           2000,   mk_bench_lvl,       nullptr,                         run_map_parse},
+    {"map_parse_expand",        2000,   mk_bench_lvl,       nullptr,                         run_map_parse_expand},
+    {"map_parse_expand_dist",   500,    mk_bench_lvl,       nullptr,                         run_map_parse_expand_dist},
+    {"perception",              200,    setup_perception,   nullptr,                         run_perception},
+    {"mon_turns",               200,    setup_mon_turns,    prepare_mon_turns,               run_mon_turns},
+    {"mon_turns_full_detail",   200,    setup_mon_turns,    prepare_mon_turns_full_detail,   run_mon_turns},
+    {"draw_map",                500,    mk_bench_lvl,       nullptr,                         run_draw_map},
+    {"draw_map_and_interface",  500,    mk_bench_lvl,       nullptr,                         run_draw_map_and_interface},
+    {"explosion",               200,    setup_explosion,    nullptr,                         run_explosion},
+    {"mk_std_lvl",              30,     nullptr,            nullptr,                         run_mk_std_lvl},
+    {"save",                    100,    mk_bench_lvl,       nullptr,                         run_save},
+    {"load",                    100,    mk_bench_lvl,       prepare_load,                    run_load},
+    {"init_session",            100,    nullptr,            nullptr,                         run_init_session}
+};
+
+//---------------------------------------------------------------- HARNESS
+double percentile(const std::vector<double>& sorted, const double PCT)
+{
+    //Nearest rank
+    const size_t RANK = size_t(PCT / 100.0 * sorted.size() + 0.999999);
+
+    return sorted[std::max(size_t(1), std::min(RANK, sorted.size())) - 1];
+}
+
+Bench_result run_case(const Bench_case& c, const int NR_REPS, const int NR_WARMUP)
+{
+    if (c.setup)
+    {
+        c.setup();
+    }
+
+    for (int i = 0; i < NR_WARMUP; ++i)
+    {
+        if (c.prepare)
+        {
+            c.prepare();
+        }
+
+        c.run();
+    }
+
+    std::vector<double> times_us;
+
+    times_us.reserve(NR_REPS);
+
+    for (int i = 0; i < NR_REPS; ++i)
+    {
+        if (c.prepare)
+        {
+            c.prepare();
+        }
+
+        const auto START = Clock::now();
+
+        c.run();
+
+        const auto END = Clock::now();
+
+        times_us.push_back(std::chrono::duration<double, std::micro>(END - START).count());
+    }
+
+    std::sort(begin(times_us), end(times_us));
+
+    double sum = 0.0;
+
+    for (double t : times_us) {sum += t;}
+
+    Bench_result result;
+
+    result.name         = c.name;
+    result.nr_reps      = NR_REPS;
+    result.min_us       = times_us.front();
+    result.median_us    = percentile(times_us, 50.0);
+    result.p99_us       = percentile(times_us, 99.0);
+    result.max_us       = times_us.back();
+    result.mean_us      = sum / NR_REPS;
+
+    return result;
+}
+
+bool write_json(const std::string& path, const std::vector<Bench_result>& results,
+                const int NR_WARMUP)
+{
+    FILE* const f = fopen(path.c_str(), "w");
+
+    if (!f)
+    {
+        return false;
+    }
+
+    fprintf(f, "{\n  \"unit\": \"us\",\n  \"warmup\": %d,\n  \"benchmarks\": [\n", NR_WARMUP);
+
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const Bench_result& r = results[i];
+
+        fprintf(f,
+                "    {\"name\": \"%s\", \"reps\": %d, \"min\": %.3f, \"median\": %.3f, "
+                "\"p99\": %.3f, \"max\": %.3f, \"mean\": %.3f}%s\n",
+                r.name.c_str(), r.nr_reps, r.min_us, r.median_us, r.p99_us, r.max_us,
+                r.mean_us, i + 1 < results.size() ? "," : "");
+    }
+
+    fprintf(f, "  ]\n}\n");
+
+    fclose(f);
+
+    return true;
+}
+
+void init_render()
+{
+    //Render to a hidden window, so that the benchmarks can run without a display
+    SDL_setenv("SDL_VIDEODRIVER", "dummy", 1);
+    SDL_setenv("SDL_AUDIODRIVER", "dummy", 1);
+
+    sdl_wrapper::init();
+    config::init();
+    render::init();
+
+    is_render_inited_ = true;
+}
+
+} //namespace
+
+#ifdef _WIN32
+#undef main
+#endif
+int main(int argc, char* argv[])
+{
+    std::string json_path   = "";
+    std::string filter      = "";
+    int         nr_reps     = -1;
+    int         nr_warmup   = 3;
+    bool        use_render  = true;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string arg = argv[i];
+
+        const bool HAS_VAL = i + 1 < argc;
+
+        if (arg == "--json" && HAS_VAL)
+        {
+            json_path = argv[++i];
+        }
+        else if (arg == "--reps" && HAS_VAL)
+        {
+            nr_reps = std::max(1, atoi(argv[++i]));
+        }
+        else if (arg == "--warmup" && HAS_VAL)
+        {
+            nr_warmup = std::max(0, atoi(argv[++i]));
+        }
+        else if (arg == "--filter" && HAS_VAL)
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "--no-render")
+        {
+            use_render = false;
+        }
+        else
+        {
+            fprintf(stderr, "Unknown argument: %s\n", arg.c_str());
+            return 1;
+        }
+    }
+
+    if (use_render)
+    {
+        init_render();
+    }
+    else
+    {
+        config::init();
+    }
+
+    //No delays for animations, no waiting for key presses
+    if (!config::is_bot_playing())
+    {
+        config::toggle_bot_playing();
+    }
+
+    init::init_game();
+    init::init_session();
+
+    std::vector<Bench_result> results;
+
+    printf("%-24s %8s %12s %12s %12s %12s\n",
+           "benchmark", "reps", "min (us)", "median (us)", "p99 (us)", "max (us)");
+
+    for (const Bench_case& c : bench_cases_)
+    {
+        if (!filter.empty() && !strstr(c.name, filter.c_str()))
+        {
+            continue;
+        }
+
+        if (!is_render_inited_ &&
+            (c.run == run_draw_map || c.run == run_draw_map_and_interface))
+        {
+            printf("%-24s (skipped, no rendering)\n", c.name);
+            continue;
+        }
+
+#ifdef ALLOC_TRACKING
+        alloc_tracking::reset_period();
+#endif // ALLOC_TRACKING
+
+        map_gen_stats::reset();
+
+        const Bench_result r = run_case(c, nr_reps > 0 ? nr_reps : c.nr_reps, nr_warmup);
+
+        printf("%-24s %8d %12.2f %12.2f %12.2f %12.2f\n",
+               r.name.c_str(), r.nr_reps, r.min_us, r.median_us, r.p99_us, r.max_us);
+
+        if (c.run == run_mk_std_lvl)
+        {
+            //The generation stages and rejections of all levels made (with warmup)
+            map_gen_stats::print_report(stdout);
+        }
+
+#ifdef ALLOC_TRACKING
+        //Allocations during the whole benchmark (setup, warmup and timed runs)
+        alloc_tracking::print_report(stdout);
+#endif // ALLOC_TRACKING
+
+        fflush(stdout);
+
+        results.push_back(r);
+    }
+
+    init::cleanup_session();
+    init::cleanup_game();
+
+    if (is_render_inited_)
+    {
+        render::cleanup();
+        sdl_wrapper::cleanup();
+    }
+
+    if (!json_path.empty() && !write_json(json_path, results, nr_warmup))
+    {
+        fprintf(stderr, "Failed to write %s\n", json_path.c_str());
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,104 @@
+//Compares the throughput of the game's random number generator (Rng) with the Mersenne
+//Twister it replaced. Build and run with "make rnd-bench".
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+
+#include "rng.hpp"
+#include "mersenne_twister.hpp"
+
+namespace
+{
+
+const int NR_CALLS = 50000000;
+
+typedef std::chrono::steady_clock Clock;
+
+double ns_per_call(const Clock::time_point& start)
+{
+    const auto NS = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        Clock::now() - start).count();
+
+    return double(NS) / NR_CALLS;
+}
+
+void report(const char* const name, const double NS, const uint32_t SUM)
+{
+    //The sum is printed so that the compiler can not drop the loops
+    printf("%-20s %6.2f ns/call  (%.0f M/s)  [%u]\n", name, NS, 1000.0 / NS, SUM);
+}
+
+} //namespace
+
+int main()
+{
+    const unsigned long SEED = 1234;
+
+    MTRand  mt_rand(SEED);
+    Rng     rng(SEED);
+
+    uint32_t sum = 0;
+
+    //Raw 32 bit numbers
+    auto start = Clock::now();
+
+    for (int i = 0; i < NR_CALLS; ++i)
+    {
+        sum += uint32_t(mt_rand.randInt());
+    }
+
+    report("mt raw", ns_per_call(start), sum);
+
+    sum   = 0;
+    start = Clock::now();
+
+    for (int i = 0; i < NR_CALLS; ++i)
+    {
+        sum += rng.next();
+    }
+
+    report("rng raw", ns_per_call(start), sum);
+
+    //Dice rolls, as done by rnd::dice() (a range of sides, varying per call)
+    sum   = 0;
+    start = Clock::now();
+
+    for (int i = 0; i < NR_CALLS; ++i)
+    {
+        const uint32_t SIDES = 2 + (i & 31);
+
+        sum += uint32_t(mt_rand.randInt(SIDES - 1)) + 1;
+    }
+
+    report("mt dice", ns_per_call(start), sum);
+
+    sum   = 0;
+    start = Clock::now();
+
+    for (int i = 0; i < NR_CALLS; ++i)
+    {
+        const uint32_t SIDES = 2 + (i & 31);
+
+        sum += rng.rand_int(SIDES) + 1;
+    }
+
+    report("rng dice", ns_per_call(start), sum);
+
+    //Splitting into streams
+    const int NR_JUMPS = 100000;
+
+    start = Clock::now();
+
+    for (int i = 0; i < NR_JUMPS; ++i)
+    {
+        rng.jump();
+    }
+
+    const auto JUMP_NS = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                             Clock::now() - start).count();
+
+    report("rng jump", double(JUMP_NS) / NR_JUMPS, rng.next());
+
+    return 0;
+}
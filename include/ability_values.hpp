@@ -1,7 +1,10 @@
 #ifndef ABILITY_VALUES_H
 #define ABILITY_VALUES_H
 
+#include "inventory.hpp"
+
 class Actor;
+class Item_data_t;
 
 enum class Ability_id
 {
@@ -19,7 +22,11 @@ enum class Ability_id
 class Ability_vals
 {
 public:
-    Ability_vals() {reset();}
+    Ability_vals() :
+        version_(0)
+    {
+        reset();
+    }
 
     Ability_vals& operator=(const Ability_vals& other)
     {
@@ -28,11 +35,14 @@ public:
             ability_list[i] = other.ability_list[i];
         }
 
+        ++version_;
+
         return *this;
     }
 
     void reset();
 
+    //NOTE: The values are cached per actor (see Ability_cache below)
     int val(const Ability_id id, const bool IS_AFFECTED_BY_PROPS, const Actor& actor) const;
 
     int raw_val(const Ability_id id)
@@ -45,7 +55,45 @@ public:
     void change_val(const Ability_id id, const int CHANGE);
 
 private:
+    int calc_val(const Ability_id id, const bool IS_AFFECTED_BY_PROPS, const Actor& actor) const;
+
+    bool is_cache_valid(const Actor& actor) const;
+
     int ability_list[int(Ability_id::END)];
+
+    //Changed whenever the base values are changed
+    int version_;
+};
+
+//The values of all abilities for an actor, and the state they were calculated from. When
+//any of this state has changed (the base values, the properties, the equipped items, or for
+//the player also the traits, background and hit points), all values are recalculated.
+struct Ability_cache
+{
+    Ability_cache() :
+        vals            (nullptr),
+        vals_version    (-1),
+        props_version   (-1),
+        bon_version     (-1),
+        hp              (-1),
+        hp_max          (-1)
+    {
+        for (int i = 0; i < int(Slot_id::END); ++i)
+        {
+            equipped[i] = nullptr;
+        }
+    }
+
+    const Ability_vals* vals;
+    int                 vals_version;
+    int                 props_version;
+    int                 bon_version;
+    int                 hp;
+    int                 hp_max;
+    const Item_data_t*  equipped[int(Slot_id::END)];
+
+    //Indexed by [is affected by properties][ability id]
+    int                 result[2][int(Ability_id::END)];
 };
 
 //TODO: Is this really necessary? Most functionality nowadays just roll their own chances.
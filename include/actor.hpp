@@ -10,6 +10,8 @@
 #include "sound.hpp"
 #include "config.hpp"
 #include "art.hpp"
+#include "alloc_tracking.hpp"
+#include "slot_map.hpp"
 
 class Prop_handler;
 class Inventory;
@@ -23,6 +25,8 @@ enum class Actor_died
 class Actor
 {
 public:
+    ALLOC_TRACKED(Alloc_cat::actor)
+
     Actor();
     virtual ~Actor();
 
@@ -194,6 +198,9 @@ public:
 
     Pos pos;
 
+    //Set when the actor is added to the game (game_time::actors_)
+    Slot_handle handle;
+
 protected:
     //TODO: Try to get rid of these friend declarations
     friend class Ability_vals;
@@ -222,6 +229,8 @@ protected:
     Prop_handler* prop_handler_;
     Actor_data_t* data_;
     Inventory* inv_;
+
+    mutable Ability_cache ability_cache_;
 };
 
 #endif
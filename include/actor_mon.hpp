@@ -108,6 +108,7 @@ public:
     double              shock_caused_cur_;
     bool                has_given_xp_for_spotting_;
     int                 nr_turns_until_unsummoned_;
+    int                 nr_turns_full_detail_;
 
 protected:
     virtual void on_hit(int& dmg) override;
@@ -115,6 +116,9 @@ protected:
     virtual bool on_actor_turn_hook() {return false;}
     virtual void on_std_turn_hook() {}
 
+    //The turn of a monster far away from the player's side (see sim_lod.hpp)
+    void act_low_detail();
+
     int group_size();
 };
 
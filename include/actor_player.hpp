@@ -51,6 +51,25 @@ public:
 
     void update_fov();
 
+    //The cells seen at the last FOV update
+    const std::vector<Pos>& seen_cells() const
+    {
+        return seen_cells_;
+    }
+
+    //The cells seen at any FOV update since the visual memory was last updated (the player
+    //may see different areas within a turn, e.g. when teleporting)
+    const std::vector<Pos>& unmemorized_cells() const
+    {
+        return unmemorized_cells_;
+    }
+
+    //For cells revealed outside of the FOV (e.g. by clairvoyance), which must be drawn as seen
+    //before the next FOV update, and then copied to the visual memory
+    void mark_unmemorized(const Pos& p);
+
+    void on_cells_memorized();
+
     bool can_see_actor(const Actor& other) const;
 
     void move(Dir dir);
@@ -111,20 +130,38 @@ public:
 
     void set_quick_move(const Dir dir);
 
+    //Travel and explore walk along a route through known cells, which is only computed when
+    //starting (and for explore, when the previous destination is reached). Like quick move,
+    //they are interrupted by messages and monsters coming into view, and also by damage.
+    //The map is not drawn for each step, only when the player stops.
+    void travel_to(const Pos& p);
+
+    void explore();
+
+    bool is_auto_moving() const
+    {
+        return !travel_path_.empty() || is_exploring_;
+    }
+
     bool is_leader_of(const Actor* const actor) const override;
     bool is_actor_my_leader(const Actor* const actor) const override;
 
     bool phobias[int(Phobia::END)];
     bool obsessions[int(Obsession::END)];
 
+    //The target is kept by handle, so it is unset automatically when the actor is deleted
+    Actor* tgt() const;
+    void set_tgt(Actor* const actor);
+
     Medical_bag* active_medical_bag;
     Explosive* active_explosive;
-    Actor* tgt_;
     int wait_turns_left;
     int ins_;
     double shock_, shock_tmp_, perm_shock_taken_cur_turn_;
 
 private:
+    Slot_handle tgt_;
+
     void incr_insanity();
 
     void test_phobias();
@@ -143,6 +180,29 @@ private:
     int nr_quick_move_steps_left_;
     Dir quick_move_dir_;
 
+    void stop_auto_move();
+
+    void travel_blocked(bool out[MAP_W][MAP_H]) const;
+
+    bool mk_explore_path();
+
+    //NOTE: The path goes from the destination to the next step (it is walked from the back)
+    std::vector<Pos> travel_path_;
+    bool is_exploring_;
+
+    //Set while a closed door on the route is opened, so the messages from this do not stop
+    //the travel (if the door does not open, the travel is stopped explicitly)
+    bool is_opening_door_on_route_;
+
+    //Destinations already picked during the current exploration (so that an area which can
+    //not be explored from there is not picked again)
+    std::vector<Pos> explore_dests_;
+
+    std::vector<Pos> seen_cells_;
+
+    std::vector<Pos> unmemorized_cells_;
+    bool is_unmemorized_[MAP_W][MAP_H];
+
     const int CARRY_WEIGHT_BASE_;
 };
 
@@ -30,6 +30,9 @@ bool step_path(Mon& mon, std::vector<Pos>& path);
 
 bool step_to_lair_if_los(Mon& mon, const Pos& lair_p);
 
+//Steps straight towards the position if the next cell is free (no path finding)
+bool step_straight_towards(Mon& mon, const Pos& p);
+
 } //action
 
 namespace info
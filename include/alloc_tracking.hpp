@@ -0,0 +1,96 @@
+#ifndef ALLOC_TRACKING_H
+#define ALLOC_TRACKING_H
+
+#include "init.hpp"
+
+#include <cstddef>
+#include <cstdio>
+
+//Counting of the heap allocated game objects, per category. The classes in each category
+//get their own operator new and delete through the ALLOC_TRACKED macro, which counts the
+//number of allocations, the bytes, and the peak number of live objects.
+//
+//The tracking is only compiled in if ALLOC_TRACKING is defined (see the options in
+//init.hpp, or build with "make ALLOC_TRACKING=1"). Otherwise ALLOC_TRACKED expands to
+//nothing, and the classes use the global operator new.
+//
+//The numbers are per thread (like the rest of the game state). When the game is started
+//with alloc_tracking::init(), the numbers for each level are appended to a CSV file when
+//the next level is made.
+
+enum class Alloc_cat
+{
+    item,
+    actor,
+    prop,
+    rigid,
+    mob,
+    room,
+    projectile,
+    ranged_att_data,
+    spell,
+    END
+};
+
+#ifdef ALLOC_TRACKING
+
+#define ALLOC_TRACKED(CAT)                                                                  \
+    static void* operator new(const std::size_t SIZE)                                       \
+    {                                                                                       \
+        return alloc_tracking::alloc(CAT, SIZE);                                            \
+    }                                                                                       \
+                                                                                            \
+    static void operator delete(void* const ptr, const std::size_t SIZE)                    \
+    {                                                                                       \
+        alloc_tracking::free(CAT, ptr, SIZE);                                               \
+    }
+
+#define ALLOC_TRACKING_ON_NEW_LVL(DLVL) alloc_tracking::on_new_lvl(DLVL)
+
+namespace alloc_tracking
+{
+
+struct Alloc_stats
+{
+    long long nr_allocs;
+    long long nr_frees;
+    long long bytes_allocd;
+    long long nr_live;
+    long long peak_nr_live;
+    long long live_bytes;
+    long long peak_live_bytes;
+};
+
+void* alloc(const Alloc_cat cat, const std::size_t size);
+
+void free(const Alloc_cat cat, void* const ptr, const std::size_t size);
+
+const Alloc_stats& stats(const Alloc_cat cat);
+
+const char* cat_name(const Alloc_cat cat);
+
+//Starts a new measuring period - the allocation counts are cleared, and the peaks are set
+//to the current number of live objects
+void reset_period();
+
+//Prints a table of the current period
+void print_report(FILE* const f);
+
+//Appends the numbers for each level to a CSV file with the given name
+void init(const char* const csv_path);
+
+void cleanup();
+
+//Writes the numbers of the level which was left, and starts a new period
+void on_new_lvl(const int DLVL);
+
+} //alloc_tracking
+
+#else
+
+#define ALLOC_TRACKED(CAT)
+#define ALLOC_TRACKING_ON_NEW_LVL(DLVL)
+
+#endif //ALLOC_TRACKING
+
+#endif
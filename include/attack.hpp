@@ -8,6 +8,7 @@
 #include "item_data.hpp"
 #include "actor_data.hpp"
 #include "art.hpp"
+#include "alloc_tracking.hpp"
 
 class Actor;
 class Wpn;
@@ -44,6 +45,8 @@ public:
 class Ranged_att_data: public Att_data
 {
 public:
+    ALLOC_TRACKED(Alloc_cat::ranged_att_data)
+
     Ranged_att_data(Actor* const attacker,
                     const Pos& attacker_orign,
                     const Pos& aim_pos,
@@ -72,6 +75,8 @@ public:
 
 struct Projectile
 {
+    ALLOC_TRACKED(Alloc_cat::projectile)
+
     Projectile() :
         pos                     (Pos(-1, -1)),
         is_obstructed           (false),
@@ -48,6 +48,10 @@ public:
     int shock_when_adj() const;
     Pos pos() const {return pos_;}
 
+    //The traits (see feature_trait), from the virtual functions above - so they include
+    //the state of this feature (e.g. if a door is open)
+    unsigned char traits() const;
+
 protected:
     Pos pos_;
 };
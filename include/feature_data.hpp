@@ -118,6 +118,17 @@ private:
 
 class Feature;
 
+//Bit flags for the traits of a rigid, as stored for each cell in map::cell_traits
+namespace feature_trait
+{
+
+const unsigned char can_move_cmn            = 1 << 0;
+const unsigned char is_los_passable         = 1 << 1;
+const unsigned char is_projectile_passable  = 1 << 2;
+const unsigned char can_have_item           = 1 << 3;
+
+} //feature_trait
+
 struct Feature_data_t
 {
     std::function<Feature*(const Pos& p)> mk_obj;
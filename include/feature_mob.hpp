@@ -2,10 +2,14 @@
 #define FEATURE_MOB_H
 
 #include "feature.hpp"
+#include "alloc_tracking.hpp"
+#include "slot_map.hpp"
 
 class Mob: public Feature
 {
 public:
+    ALLOC_TRACKED(Alloc_cat::mob)
+
     Mob(const Pos& feature_pos) : Feature(feature_pos) {}
 
     Mob() = delete;
@@ -17,29 +21,9 @@ public:
     Clr                 clr()                        const override = 0;
 
     Clr clr_bg() const override final {return clr_black;}
-};
-
-class Smoke: public Mob
-{
-public:
-    Smoke(const Pos& feature_pos, const int NR_TURNS) :
-        Mob(feature_pos), nr_turns_left_(NR_TURNS) {}
-
-    //Spawn-by-id compliant ctor (do not use for normal cases):
-    Smoke(const Pos& feature_pos) : Mob(feature_pos), nr_turns_left_(-1) {}
 
-    Smoke() = delete;
-    ~Smoke() {}
-
-    Feature_id id() const override {return Feature_id::smoke;}
-
-    std::string name(const Article article)  const override;
-    Clr         clr()                        const override;
-
-    void on_new_turn() override;
-
-protected:
-    int nr_turns_left_;
+    //Set when the mob is added to the game (game_time::mobs_)
+    Slot_handle handle;
 };
 
 class Lit_dynamite: public Mob
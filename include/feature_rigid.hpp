@@ -2,6 +2,7 @@
 #define FEATURE_RIGID_H
 
 #include "feature.hpp"
+#include "alloc_tracking.hpp"
 
 enum class Burn_state       {not_burned, burning, has_burned};
 
@@ -12,6 +13,8 @@ enum class Did_open         {no, yes};
 class Rigid: public Feature
 {
 public:
+    ALLOC_TRACKED(Alloc_cat::rigid)
+
     Rigid(const Pos& feature_pos);
 
     Rigid() = delete;
@@ -24,6 +27,10 @@ public:
 
     virtual void on_new_turn() override final;
 
+    //Fire damage and spreading for one turn, called by fire_smoke::on_new_turn() for the
+    //rigids which were burning at the start of the turn
+    void on_burning_turn(Actor* const living_actors[MAP_W][MAP_H]);
+
     Clr clr() const override final;
 
     virtual Clr clr_bg() const override final;
@@ -0,0 +1,36 @@
+#ifndef FIRE_SMOKE_H
+#define FIRE_SMOKE_H
+
+#include "cmn_data.hpp"
+#include "cmn_types.hpp"
+
+//Fire and smoke are simulated as grids over the map. Only the region around the burning
+//cells and the region around the smoke is visited each turn, so a level without fire or
+//smoke costs nothing.
+//
+//The burn state is kept by the rigids (it decides e.g. their color and if they can be
+//opened), but which cells burn during a turn is decided by a snapshot taken at the start
+//of the turn. Cells set on fire during the turn start burning on the next turn, so the
+//spread does not depend on the order the cells are visited in.
+namespace fire_smoke
+{
+
+void reset();
+
+//Adds smoke which lasts for the given number of turns (if there is already smoke on the
+//cell, the longer duration is kept)
+void put_smoke(const Pos& p, const int NR_TURNS);
+
+bool is_smoke_at(const Pos& p);
+
+//Sets the cells with smoke inside the area to true
+void mark_smoke(bool out[MAP_W][MAP_H], const Rect& area);
+
+//Called by rigids when they start burning
+void on_start_burning(const Pos& p);
+
+void on_new_turn();
+
+} //fire_smoke
+
+#endif
@@ -5,6 +5,7 @@
 
 #include "feature.hpp"
 #include "actor_data.hpp"
+#include "slot_map.hpp"
 
 class Mob;
 
@@ -21,8 +22,8 @@ enum class Turn_type
 namespace game_time
 {
 
-extern std::vector<Actor*> actors_;
-extern std::vector<Mob*> mobs_;
+extern thread_local Slot_map<Actor> actors_;
+extern thread_local Slot_map<Mob> mobs_;
 
 void init();
 void cleanup();
@@ -38,6 +39,7 @@ int turn();
 
 Actor* cur_actor();
 
+//NOTE: The order of the actors is not kept (the last actor is moved into the erased element)
 void erase_actor_in_element(const size_t i);
 
 void mobs_at_pos(const Pos& pos, std::vector<Mob*>& vector_ref);
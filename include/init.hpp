@@ -18,6 +18,14 @@
 //Enable rendering and delays during map gen for evaluation/demo purposes
 //Comment out to disable, uncomment to enable
 //#define DEMO_MODE 1
+
+//Record the time spent in each subsystem per turn, see profiler.hpp
+//Comment out to disable, uncomment to enable (or build with "make PROFILE=1")
+//#define PROFILER 1
+
+//Count the allocations of game objects per category and level, see alloc_tracking.hpp
+//Comment out to disable, uncomment to enable (or build with "make ALLOC_TRACKING=1")
+//#define ALLOC_TRACKING 1
 //-----------------------------------------------------------------------------
 
 #ifdef NDEBUG
@@ -55,11 +63,16 @@
 
 #endif
 
+//The game state (map, actors, data tables, random number generator, message log, etc) is
+//thread local, so each thread runs its own independent game. The IO and the data set up
+//by init_game() is shared by the whole process - call init_iO() and init_game() once from
+//the main thread before starting any game threads. Every thread running a game then calls
+//init_session() and cleanup_session() for itself.
 namespace init
 {
 
-extern bool is_cheat_vision_enabled;
-extern bool quit_to_main_menu;
+extern thread_local bool is_cheat_vision_enabled;
+extern thread_local bool quit_to_main_menu;
 
 void init_iO();
 void cleanup_iO();
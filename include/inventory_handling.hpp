@@ -13,9 +13,9 @@ enum class Inv_scr
 namespace inv_handling
 {
 
-extern Inv_scr      scr_to_open_on_new_turn;
-extern Inv_slot*    equip_slot_to_open_on_new_turn;
-extern int          browser_idx_to_set_on_new_turn;
+extern thread_local Inv_scr      scr_to_open_on_new_turn;
+extern thread_local Inv_slot*    equip_slot_to_open_on_new_turn;
+extern thread_local int          browser_idx_to_set_on_new_turn;
 
 void init();
 
@@ -5,6 +5,7 @@
 #include "inventory_handling.hpp"
 #include "converters.hpp"
 #include "cmn_data.hpp"
+#include "alloc_tracking.hpp"
 
 class Item_data_t;
 class Prop;
@@ -20,6 +21,8 @@ enum class Item_activate_ret_type
 class Item
 {
 public:
+    ALLOC_TRACKED(Alloc_cat::item)
+
     Item(Item_data_t* item_data);
 
     Item(Item& other) = delete;
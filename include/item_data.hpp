@@ -261,13 +261,12 @@ public:
     struct Item_melee_data
     {
         Item_melee_data();
-        ~Item_melee_data();
 
         bool                    is_melee_wpn;
         std::pair<int, int>     dmg;
         int                     hit_chance_mod;
         Item_att_msgs           att_msgs;
-        Prop*                   prop_applied;
+        Prop*                   prop_applied;   //NOTE: Shared by all sessions (never deleted)
         Dmg_type                dmg_type;
         bool                    knocks_back;
         Sfx_id                  hit_small_sfx;
@@ -279,7 +278,6 @@ public:
     struct Item_ranged_data
     {
         Item_ranged_data();
-        ~Item_ranged_data();
 
         bool                    is_ranged_wpn, is_machine_gun, is_shotgun;
         //NOTE: This property should be set on ranged weapons (using ammo) and clips
@@ -305,7 +303,7 @@ public:
         bool                    makes_ricochet_snd;
         Sfx_id                  att_sfx;
         Sfx_id                  reload_sfx;
-        Prop*                   prop_applied;
+        Prop*                   prop_applied;   //NOTE: Shared by all sessions (never deleted)
     } ranged;
 
     struct Item_armor_data
@@ -322,7 +320,7 @@ class Item;
 namespace item_data
 {
 
-extern Item_data_t data[int(Item_id::END)];
+extern thread_local Item_data_t data[int(Item_id::END)];
 
 void init();
 void cleanup();
@@ -2,6 +2,7 @@
 #define LINE_CALC_H
 
 #include <vector>
+#include <cstdint>
 
 #include "cmn_data.hpp"
 #include "cmn_types.hpp"
@@ -9,14 +10,76 @@
 namespace line_calc
 {
 
+struct Line_delta
+{
+    int8_t x, y;
+};
+
+//A precalculated line from (0, 0) - the offsets are stored in one flat table, shared by
+//all lines
+class Delta_line
+{
+public:
+    Delta_line() :
+        deltas_ (nullptr),
+        size_   (0) {}
+
+    Delta_line(const Line_delta* const deltas, const size_t SIZE) :
+        deltas_ (deltas),
+        size_   (SIZE) {}
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    Pos operator[](const size_t i) const
+    {
+        return Pos(deltas_[i].x, deltas_[i].y);
+    }
+
+private:
+    const Line_delta*   deltas_;
+    size_t              size_;
+};
+
+//Steps through the same cells as calc_new_line(), without storing the line. Lines which
+//stop at a target within FOV_MAX_RADI_INT are read from the precalculated table.
+class Line_iter
+{
+public:
+    Line_iter(const Pos& origin, const Pos& tgt,
+              const bool SHOULD_STOP_AT_TARGET, const int CHEB_TRAVEL_LIMIT,
+              const bool ALLOW_OUTSIDE_MAP);
+
+    Line_iter() = delete;
+
+    //Returns false when the line has ended
+    bool next(Pos& out);
+
+private:
+    const Pos           origin_;
+    const Pos           tgt_;
+    const bool          SHOULD_STOP_AT_TARGET_;
+    const int           CHEB_TRAVEL_LIMIT_;
+    const bool          ALLOW_OUTSIDE_MAP_;
+    const Delta_line*   delta_line_;
+    size_t              delta_idx_;
+    double              x_incr_, y_incr_;
+    double              cur_x_, cur_y_;
+    double              nr_steps_;
+    Pos                 prev_;
+    bool                has_prev_;
+    bool                is_done_;
+};
+
 void init();
 
 void calc_new_line(const Pos& origin, const Pos& tgt,
                    const bool SHOULD_STOP_AT_TARGET, const int CHEB_TRAVEL_LIMIT,
                    const bool ALLOW_OUTSIDE_MAP, std::vector<Pos>& line_ref);
 
-const std::vector<Pos>* fov_delta_line(const Pos& delta,
-                                       const double& MAX_DIST_ABS);
+const Delta_line* fov_delta_line(const Pos& delta, const double& MAX_DIST_ABS);
 
 } //line_calc
 
@@ -15,6 +15,8 @@
 class Save_handler;
 class Rigid;
 
+//NOTE: Only data used by the simulation (light, FOV, map parsing etc) belongs here, to keep
+//the cell array small - the player's visual memory is stored separately in the renderer.
 struct Cell
 {
     Cell();
@@ -26,7 +28,6 @@ struct Cell
     Los_result          player_los; //Updated when player updates FOV
     Item*               item;
     Rigid*              rigid;
-    Cell_render_data    player_visual_memory;
     Pos                 pos;
 };
 
@@ -44,13 +45,17 @@ enum class Map_type
 namespace map
 {
 
-extern Player*              player;
-extern int                  dlvl;
-extern Cell                 cells[MAP_W][MAP_H];
-extern std::vector<Room*>   room_list;              //Owns the rooms
-extern Room*                room_map[MAP_W][MAP_H]; //Helper array
+extern thread_local Player*              player;
+extern thread_local int                  dlvl;
+extern thread_local Cell                 cells[MAP_W][MAP_H];
+extern thread_local std::vector<Room*>   room_list;              //Owns the rooms
+extern thread_local Room*                room_map[MAP_W][MAP_H]; //Helper array
 
-extern Clr                  wall_clr;
+//The traits of the rigid on each cell (see feature_trait), so that map parsing can test
+//them with lookups. The map edge has no traits (it blocks everything).
+extern thread_local unsigned char        cell_traits[MAP_W][MAP_H];
+
+extern thread_local Clr                  wall_clr;
 
 void init();
 void cleanup();
@@ -61,9 +66,11 @@ void reset_map();
 
 Rigid* put(Rigid* const rigid);
 
-//Makes a copy of the renderers current array
-//TODO: This is weird, and it's unclear how it should be used. Remove?
-//Can it not be copied in the map drawing function instead?
+//Must be called when the traits of a rigid on the map change (e.g. a door is opened)
+void update_cell_traits(const Pos& p);
+
+//Copies the renderers current array to the player visual memory, for the cells seen at any
+//player FOV update since the last copy (the map must have been drawn after each update)
 void cpy_render_array_to_visual_memory();
 
 void mk_blood(const Pos& origin);
@@ -5,6 +5,8 @@
 
 #include "cmn_types.hpp"
 #include "map_templates.hpp"
+#include "union_find.hpp"
+#include "map_gen_stats.hpp"
 
 class Room;
 
@@ -33,10 +35,52 @@ void cut_room_corners(const Room& room);
 void mk_pillars_in_room(const Room& room);
 void cavify_room(Room& room);
 
+//Keeps track of which free cells are connected to each other (also diagonally, as in
+//map_parse::is_map_connected()). The map is only scanned once, when the object is created -
+//after that, cells which become free must be reported through on_cell_freed().
+class Free_cell_sets
+{
+public:
+    Free_cell_sets();
+
+    void on_cell_freed(const Pos& p);
+
+    bool is_free(const Pos& p) const
+    {
+        return is_free_[p.x][p.y];
+    }
+
+    //Cells in the same set are connected. Ids should be compared with is_same_set(), since
+    //the id of a set may change when sets are merged.
+    int set_id(const Pos& p);
+
+    bool is_same_set(const int SET_ID_0, const int SET_ID_1);
+
+    bool is_all_connected() const
+    {
+        return nr_sets_ <= 1;
+    }
+
+private:
+    Union_find  sets_;
+    bool        is_free_[MAP_W][MAP_H];
+    int         nr_sets_;
+};
+
 void valid_room_corr_entries(const Room& room, std::vector<Pos>& out);
 
+//If "free_cells" is set, the carved cells are reported to it
 void mk_path_find_cor(Room& r0, Room& r1,
-                      bool door_proposals[MAP_W][MAP_H] = nullptr);
+                      bool door_proposals[MAP_W][MAP_H] = nullptr,
+                      Free_cell_sets* const free_cells = nullptr);
+
+//Connects all sets of rooms which are not yet connected to each other. A single weighted
+//distance field is computed from the corridor entries of all standard rooms, and the
+//cheapest corridor between two sets is found where their regions meet and carved. This is
+//repeated (with the new corridor blocking the field) until all sets are joined. Returns
+//true if all free cells are connected afterwards.
+bool mk_cors_to_unconnected_rooms(Free_cell_sets& free_cells,
+                                  bool door_proposals[MAP_W][MAP_H]);
 
 void backup_map();
 void restore_map();
@@ -56,7 +100,10 @@ namespace map_gen
 //This variable is checked at certain points to see if the current map
 //has been flagged as "failed". Setting is_map_valid to false will generally
 //stop map generation, discard the map, and trigger generation of a new map.
-extern bool is_map_valid;
+extern thread_local bool is_map_valid;
+
+//Flags the current map as failed, and records the reason in the map generation stats
+void reject_map(const Map_gen_reject reason);
 
 bool mk_intro_lvl();
 bool mk_std_lvl();
@@ -0,0 +1,108 @@
+#ifndef MAP_GEN_STATS_H
+#define MAP_GEN_STATS_H
+
+#include <chrono>
+#include <cstdio>
+
+//Telemetry of the standard level generation. Each attempt at making a level records the time
+//spent in each generation stage, and the reason the level was rejected (if it was). The
+//numbers are summed over all attempts since the last reset, so that a report can be printed
+//after making levels from many seeds (e.g. by the "mk_std_lvl" benchmark).
+//
+//The numbers are per thread (like the rest of the game state).
+
+enum class Map_gen_stage
+{
+    reset,
+    river,
+    merged_regions,
+    blocked_regions,
+    main_rooms,
+    aux_rooms,
+    sub_rooms,
+    pre_connect,
+    connect,
+    post_connect,
+    dead_ends,
+    doors,
+    player_pos,
+    decorate,
+    populate_mon,
+    populate_traps,
+    populate_items,
+    stairs,
+    reveal_path,
+    END
+};
+
+enum class Map_gen_reject
+{
+    river_not_bridged,
+    unreachable_rooms,
+    rooms_not_connected,
+    too_few_free_cells,
+    no_player_cell,
+    too_few_stair_cells,
+    END
+};
+
+namespace map_gen_stats
+{
+
+struct Stage_stats
+{
+    long long   nr_runs;
+    double      tot_us;
+    double      max_us;
+};
+
+void reset();
+
+void on_attempt_begin();
+
+void on_attempt_end(const bool IS_VALID);
+
+void on_stage_done(const Map_gen_stage stage, const double US);
+
+void on_reject(const Map_gen_reject reason);
+
+long long nr_attempts();
+
+long long nr_valid();
+
+long long nr_rejects(const Map_gen_reject reason);
+
+const Stage_stats& stage_stats(const Map_gen_stage stage);
+
+const char* stage_name(const Map_gen_stage stage);
+
+const char* reject_name(const Map_gen_reject reason);
+
+//Prints the time spent in each stage, and the rejections
+void print_report(FILE* const f);
+
+//Records the time from construction to destruction as a run of the given stage
+class Stage_timer
+{
+public:
+    explicit Stage_timer(const Map_gen_stage stage) :
+        stage_  (stage),
+        start_  (std::chrono::steady_clock::now()) {}
+
+    Stage_timer() = delete;
+
+    ~Stage_timer()
+    {
+        const auto END = std::chrono::steady_clock::now();
+
+        on_stage_done(stage_, std::chrono::duration<double, std::micro>(END - start_).count());
+    }
+
+private:
+    Map_gen_stage                           stage_;
+    std::chrono::steady_clock::time_point   start_;
+};
+
+} //map_gen_stats
+
+#endif
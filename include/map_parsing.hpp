@@ -24,6 +24,11 @@ public:
     virtual bool check(const Cell& c)       const {(void)c; return false;}
     virtual bool check(const Mob& f) const {(void)f; return false;}
     virtual bool check(const Actor& a)      const {(void)a; return false;}
+
+    //If not zero, the cell check is true for the cells lacking any of these traits (see
+    //map::cell_traits), and map_parse::run tests the cells by lookups instead of calling
+    //check() for each cell
+    virtual unsigned char required_traits() const {return 0;}
 protected:
     Check() {}
 };
@@ -36,6 +41,11 @@ public:
     bool is_checking_mobs()         const override {return true;}
     bool check(const Cell& c)       const override;
     bool check(const Mob& f)        const override;
+
+    unsigned char required_traits() const override
+    {
+        return feature_trait::is_los_passable;
+    }
 };
 
 class Blocks_move_cmn : public Check
@@ -49,6 +59,11 @@ public:
     bool check(const Cell& c)       const override;
     bool check(const Mob& f)        const override;
     bool check(const Actor& a)      const override;
+
+    unsigned char required_traits() const override
+    {
+        return feature_trait::can_move_cmn;
+    }
 private:
     const bool IS_ACTORS_BLOCKING_;
 };
@@ -79,6 +94,11 @@ public:
     bool is_checking_mobs()         const override {return true;}
     bool check(const Cell& c)       const override;
     bool check(const Mob& f)        const override;
+
+    unsigned char required_traits() const override
+    {
+        return feature_trait::is_projectile_passable;
+    }
 };
 
 class Living_actors_adj_to_pos : public Check
@@ -99,6 +119,11 @@ public:
     bool is_checking_mobs()         const override {return true;}
     bool check(const Cell& c)       const override;
     bool check(const Mob& f)        const override;
+
+    unsigned char required_traits() const override
+    {
+        return feature_trait::can_have_item;
+    }
 };
 
 //class Corridor : public Check {
@@ -226,8 +251,45 @@ void expand(const bool in[MAP_W][MAP_H], bool out[MAP_W][MAP_H],
 //Slower version that can expand any distance
 void expand(const bool in[MAP_W][MAP_H], bool out[MAP_W][MAP_H], const int DIST);
 
+//Labels the connected groups of free cells (diagonal steps are allowed). Blocked cells are
+//set to -1, and the free cells are set to their group number, from 0 up to the number of
+//groups - 1. Returns the number of groups.
+int label_components(const bool blocked[MAP_W][MAP_H], int out[MAP_W][MAP_H]);
+
 bool is_map_connected(const bool blocked[MAP_W][MAP_H]);
 
+//For placing several blocking things on the map without disconnecting it, e.g. trees.
+//
+//Most cells can be blocked safely just because their free neighbours are connected around
+//them, which is checked first. Otherwise, the cells which would split the map if they were
+//blocked (articulation points) are found with one depth first search, instead of flood
+//filling the map for every candidate cell. The search is only done again when a cell has
+//been blocked since the last search.
+class Map_connectivity
+{
+public:
+    Map_connectivity(const bool blocked[MAP_W][MAP_H]);
+
+    bool is_connected();
+
+    //Would the map still be connected if this (free) cell was blocked?
+    bool is_connected_if_blocked(const Pos& p);
+
+    void block(const Pos& p);
+
+private:
+    //Number of groups of free neighbours, connected without going through the cell
+    int nr_free_adj_groups(const Pos& p) const;
+
+    void update();
+
+    bool    blocked_[MAP_W][MAP_H];
+    bool    is_cut_cell_[MAP_W][MAP_H];
+    int     nr_components_;
+    bool    is_nr_components_valid_;
+    bool    is_cut_cells_valid_;
+};
+
 } //map_parse
 
 //Function object for sorting STL containers by distance to a position
@@ -21,7 +21,7 @@ struct map_data
 namespace map_travel
 {
 
-extern std::vector<map_data> map_list;
+extern thread_local std::vector<map_data> map_list;
 
 void init();
 
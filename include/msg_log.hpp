@@ -8,42 +8,48 @@
 #include "converters.hpp"
 #include "cmn_types.hpp"
 
+//A message in the log. The text is owned by the message log (each distinct text is stored
+//once, and shared by all messages with that text).
 class Msg
 {
 public:
-    Msg(const std::string& text, const Clr& clr, const int X_POS) :
+    Msg(const std::string* const text, const Clr& clr, const int X_POS, const bool IS_NEW_LINE) :
         clr_            (clr),
         x_pos_          (X_POS),
+        is_new_line_    (IS_NEW_LINE),
         str_            (text),
-        repeats_str_    (""),
         nr_             (1) {}
 
     Msg() :
         clr_            (clr_white),
         x_pos_          (0),
-        str_            (""),
-        repeats_str_    (""),
+        is_new_line_    (true),
+        str_            (nullptr),
         nr_             (1) {}
 
     void str_with_repeats(std::string& str_ref) const
     {
-        str_ref = str_ + (nr_ > 1 ? repeats_str_ : "");
+        str_ref = *str_ + (nr_ > 1 ? repeats_str() : "");
     }
 
-    void str_raw(std::string& str_ref) const {str_ref = str_;}
+    const std::string& str_raw() const {return *str_;}
 
-    void incr_repeat()
+    //Length of the text as drawn (with the repeat count)
+    int len_with_repeats() const
     {
-        nr_++;
-        repeats_str_ = "(x" + to_str(nr_) + ")";
+        return str_->size() + (nr_ > 1 ? repeats_str().size() : 0);
     }
 
-    Clr clr_;
-    int x_pos_;
+    void incr_repeat() {++nr_;}
+
+    Clr     clr_;
+    int     x_pos_;
+    bool    is_new_line_;
 
 private:
-    std::string str_;
-    std::string repeats_str_;
+    std::string repeats_str() const {return "(x" + to_str(nr_) + ")";}
+
+    const std::string* str_;
     int nr_;
 };
 
@@ -57,6 +63,12 @@ void add(const std::string&         str,
          const bool                 INTERRUPT_PLAYER_ACTIONS    = false,
          const More_prompt_on_msg   add_more_prompt_on_msg      = More_prompt_on_msg::no);
 
+//When the log is disabled (e.g. in simulations where nobody is watching), added messages are
+//dropped, and callers may skip building them. The setting is not changed by init().
+void set_enabled(const bool IS_ENABLED);
+
+bool is_enabled();
+
 //NOTE: This function can safely be called at any time. If there is content in the log,
 //a "more" prompt will be done, and the log is cleared. If the log happens to be empty,
 //nothing is done.
@@ -70,7 +82,10 @@ void clear();
 
 void add_line_to_history(const std::string& line_to_add);
 
-const std::vector< std::vector<Msg> >& history();
+//The history is a ring buffer of the last messages, which is laid out in lines (of at most
+//the given width) only when requested. The messages refer to text owned by the log, and
+//are only valid until the next message is added.
+void history_lines(const int W, std::vector< std::vector<Msg> >& out);
 
 } //log
 
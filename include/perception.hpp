@@ -0,0 +1,31 @@
+#ifndef PERCEPTION_H
+#define PERCEPTION_H
+
+#include <vector>
+
+class Actor;
+class Mon;
+
+//Which hostile actors each monster can see, computed for all monsters in one pass. The
+//first monster asking during a turn phase runs the pass for every monster: the blocked
+//LOS map is built once (over the area seen by any monster), and each pair of actors is
+//culled by faction and distance once. Line of sight is then checked in each direction,
+//since seeing is not symmetric (it depends on the properties of the viewer, such as
+//blindness or infravision).
+//
+//The results are kept until the player acts, a new turn phase starts, or an actor is
+//added or removed - so during a phase, monsters see each other where they were when the
+//pass ran. Actors which have died since then are left out.
+namespace perception
+{
+
+//Discards the results, the next request runs a new pass
+void invalidate();
+
+//Returns false if there is no result for the monster (if it is not in the actors vector),
+//then the caller must check by itself
+bool seen_foes(const Mon& mon, std::vector<Actor*>& out);
+
+} //perception
+
+#endif
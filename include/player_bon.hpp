@@ -68,7 +68,8 @@ enum class Bg
 namespace player_bon
 {
 
-extern bool traits[int(Trait::END)];
+//NOTE: Traits should only be set through the functions below (see version())
+extern thread_local bool traits[int(Trait::END)];
 
 void init();
 
@@ -84,6 +85,9 @@ void trait_prereqs(const Trait id, std::vector<Trait>& traits_ref, Bg& bg_ref);
 
 Bg bg();
 
+//Changed whenever the background or traits change (for caching values derived from them)
+int version();
+
 std::string trait_title(const Trait id);
 std::string trait_descr(const Trait id);
 
@@ -0,0 +1,88 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include "init.hpp"
+
+//Scoped timers and counters, for finding out which subsystem a slow turn spent its time in.
+//
+//The profiler is only compiled in if PROFILER is defined (see the options in init.hpp, or
+//build with "make PROFILE=1"). Otherwise the PROFILE_* macros expand to nothing.
+//
+//Each timed zone records its number of calls, its total time, and its self time (the total
+//time minus the time spent in zones started inside it). At the start of every standard turn
+//the numbers for the previous turn are appended to "<name>_turns.csv", one line per zone.
+//Every timed scope is also written as an event to "<name>_trace.json", which can be opened
+//in chrome://tracing (or Perfetto) to see the nesting. The events are kept in memory during
+//the turn, and written together with the turn numbers.
+//
+//Recording is per thread - only threads which have called profiler::init() record anything.
+
+#ifdef PROFILER
+
+#include <string>
+
+#define PROFILER_CAT_(A, B) A##B
+#define PROFILER_CAT(A, B)  PROFILER_CAT_(A, B)
+
+//NAME must be a string literal (the pointer is kept)
+#define PROFILE_SCOPE(NAME)                                                                 \
+    static const int PROFILER_CAT(profile_id_, __LINE__) = profiler::id(NAME);             \
+    profiler::Scope PROFILER_CAT(profile_scope_, __LINE__)(PROFILER_CAT(profile_id_, __LINE__))
+
+#define PROFILE_NEW_TURN(TURN_NR) profiler::on_new_turn(TURN_NR)
+
+#define PROFILE_COUNT(NAME, VAL)                                                            \
+    do                                                                                      \
+    {                                                                                       \
+        static const int PROFILE_COUNT_ID = profiler::id(NAME);                             \
+        profiler::count(PROFILE_COUNT_ID, VAL);                                             \
+    } while (false)
+
+namespace profiler
+{
+
+//Starts recording on the calling thread, writing to files with the given name prefix
+void init(const std::string& name);
+
+//Writes the last turn and closes the files
+void cleanup();
+
+//Writes the numbers of the previous turn, and starts a new turn
+void on_new_turn(const int TURN_NR);
+
+//Returns the id for a zone or counter name (the same name always gives the same id)
+int id(const char* const name);
+
+void count(const int ID, const long long VAL);
+
+class Scope
+{
+public:
+    explicit Scope(const int ID);
+
+    Scope() = delete;
+
+    ~Scope();
+
+    //Leaves out time spent by the profiler itself, from this scope and the scopes around it
+    void exclude_us(const double US);
+
+private:
+    int     id_;
+    Scope*  parent_;
+    double  start_us_;
+    double  child_us_;
+    double  excluded_us_;
+};
+
+} //profiler
+
+#else
+
+#define PROFILE_SCOPE(NAME)
+#define PROFILE_NEW_TURN(TURN_NR)
+#define PROFILE_COUNT(NAME, VAL)
+
+#endif //PROFILER
+
+#endif
@@ -8,6 +8,7 @@
 #include "cmn_data.hpp"
 #include "converters.hpp"
 #include "cmn_types.hpp"
+#include "alloc_tracking.hpp"
 
 enum class Prop_id
 {
@@ -145,7 +146,7 @@ struct Prop_data_t
 namespace prop_data
 {
 
-extern Prop_data_t data[size_t(Prop_id::END)];
+extern const Prop_data_t (&data)[size_t(Prop_id::END)];
 
 void init();
 
@@ -226,6 +227,12 @@ public:
 
     int ability_mod(const Ability_id ability) const;
 
+    //Changed whenever a property is added or removed
+    int version() const
+    {
+        return version_;
+    }
+
     bool change_actor_clr(Clr& clr) const;
 
     void tick(const Prop_turn_mode turn_mode);
@@ -251,12 +258,16 @@ private:
     //so that we can search through the vector as little as possible.
     int active_props_info_[size_t(Prop_id::END)];
 
+    int version_;
+
     Actor* owning_actor_;
 };
 
 class Prop
 {
 public:
+    ALLOC_TRACKED(Alloc_cat::prop)
+
     Prop(Prop_id id, Prop_turns turns_init, int nr_turns = -1);
 
     virtual ~Prop() {}
@@ -24,16 +24,52 @@ enum class Panel
 namespace render
 {
 
-extern Cell_render_data render_array[MAP_W][MAP_H];
-extern Cell_render_data render_array_no_actors[MAP_W][MAP_H];
+extern thread_local Cell_render_data render_array[MAP_W][MAP_H];
+extern thread_local Cell_render_data render_array_no_actors[MAP_W][MAP_H];
+
+//What the player remembers seeing in each cell
+extern thread_local Cell_render_data player_visual_memory[MAP_W][MAP_H];
 
 void init();
 void cleanup();
 
 void draw_map_and_interface(const bool SHOULD_UPDATE_SCREEN = true);
 
+//The log and character lines panels are kept on the screen between frames, and their
+//owners only draw them again when the content has changed. A panel is no longer retained
+//when anything else is drawn over it (e.g. a menu or a popup), or when the screen is
+//cleared - it must then be drawn again.
+bool is_panel_retained(const Panel panel);
+
+//Drawing done between these calls is the content of the given panel, and does not
+//invalidate it. The panel is retained afterwards.
+void begin_retained_panel(const Panel panel);
+void end_retained_panel();
+
+//Sets up the render data of the features and items in the seen cells, without drawing
+//anything. This is the data copied to the player's visual memory, so it must be updated
+//each turn even if the map is not drawn (e.g. while travelling).
+void update_seen_cells_render_data();
+
+//Only the parts of the screen drawn on since the last update are copied to the window. While
+//the present loop runs, the game thread only publishes the frame, and does not wait for it to
+//be presented.
 void update_screen();
 
+//The game may run on a thread of its own, while the main thread (which owns the window and
+//the SDL renderer) runs the present loop - it pumps the window events, and uploads and
+//presents the frames published by the game thread.
+//
+//Called on the main thread before the game thread is started. Returns false if the present
+//loop cannot be used (the game should then run on the main thread).
+bool start_present_loop();
+
+//Runs on the main thread until stop_present_loop() is called
+void run_present_loop();
+
+//Called on the game thread when the game is done
+void stop_present_loop();
+
 void clear_screen();
 
 void draw_tile(const Tile_id tile, const Panel panel, const Pos& pos,
@@ -0,0 +1,120 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <cstdint>
+
+//xoshiro128** by David Blackman and Sebastiano Vigna (public domain, see prng.di.unimi.it).
+//The state is four 32 bit words, so it is cheap to copy, and jump() advances the sequence
+//by 2^64 steps - this is used for splitting one seed into independent streams.
+class Rng
+{
+public:
+    Rng()
+    {
+        seed(0);
+    }
+
+    explicit Rng(const uint64_t SEED)
+    {
+        seed(SEED);
+    }
+
+    void seed(uint64_t val)
+    {
+        //The state is filled by splitmix64, so that similar seeds still give unrelated states
+        for (int i = 0; i < 4; i += 2)
+        {
+            val += 0x9e3779b97f4a7c15ULL;
+
+            uint64_t z = val;
+
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            z =  z ^ (z >> 31);
+
+            s_[i]       = uint32_t(z);
+            s_[i + 1]   = uint32_t(z >> 32);
+        }
+    }
+
+    uint32_t next()
+    {
+        const uint32_t RESULT   = rotl(s_[1] * 5, 7) * 9;
+        const uint32_t T        = s_[1] << 9;
+
+        s_[2] ^= s_[0];
+        s_[3] ^= s_[1];
+        s_[1] ^= s_[2];
+        s_[0] ^= s_[3];
+
+        s_[2] ^= T;
+
+        s_[3] = rotl(s_[3], 11);
+
+        return RESULT;
+    }
+
+    //Returns a value in the range [0, N - 1], without modulo bias (N must be above zero)
+    uint32_t rand_int(const uint32_t N)
+    {
+        //Lemire's multiply and shift method - a division is only needed when rejecting
+        uint64_t m = uint64_t(next()) * N;
+
+        uint32_t low = uint32_t(m);
+
+        if (low < N)
+        {
+            const uint32_t THRESHOLD = uint32_t(-N) % N;
+
+            while (low < THRESHOLD)
+            {
+                m   = uint64_t(next()) * N;
+                low = uint32_t(m);
+            }
+        }
+
+        return uint32_t(m >> 32);
+    }
+
+    //Equivalent to 2^64 calls to next()
+    void jump()
+    {
+        static const uint32_t JUMP[] = {0x8764000b, 0xf542d2d3, 0x6fa035c3, 0x77f2db5b};
+
+        uint32_t s0 = 0;
+        uint32_t s1 = 0;
+        uint32_t s2 = 0;
+        uint32_t s3 = 0;
+
+        for (const uint32_t WORD : JUMP)
+        {
+            for (int b = 0; b < 32; ++b)
+            {
+                if (WORD & (uint32_t(1) << b))
+                {
+                    s0 ^= s_[0];
+                    s1 ^= s_[1];
+                    s2 ^= s_[2];
+                    s3 ^= s_[3];
+                }
+
+                next();
+            }
+        }
+
+        s_[0] = s0;
+        s_[1] = s1;
+        s_[2] = s2;
+        s_[3] = s3;
+    }
+
+private:
+    static uint32_t rotl(const uint32_t X, const int K)
+    {
+        return (X << K) | (X >> (32 - K));
+    }
+
+    uint32_t s_[4];
+};
+
+#endif
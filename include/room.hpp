@@ -10,6 +10,7 @@
 
 #include "cmn_types.hpp"
 #include "cmn_data.hpp"
+#include "alloc_tracking.hpp"
 
 //---------------------------------------------------------------------------------------
 // Room theming occurs both before and after rooms are connected (pre/post-connect).
@@ -67,6 +68,8 @@ Room* mk_random_allowed_std_room(const Rect& r, const bool IS_SUBROOM);
 class Room
 {
 public:
+    ALLOC_TRACKED(Alloc_cat::room)
+
     Room(Rect r, Room_type type);
 
     Room() = delete;
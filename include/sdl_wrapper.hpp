@@ -12,6 +12,10 @@ void cleanup();
 
 void sleep(const Uint32 DURATION);
 
+//The main thread is the one which called init() - it owns the window, and is the only one
+//allowed to pump the window events
+bool is_main_thread();
+
 }
 
 #endif
@@ -0,0 +1,35 @@
+#ifndef SIM_LOD_H
+#define SIM_LOD_H
+
+#include "cmn_types.hpp"
+#include "cmn_data.hpp"
+
+class Mon;
+
+//Level of detail for the monster simulation. A monster which is not aware of the player,
+//and is far away from the player and the player's allies, can not see any of them (and can
+//not be seen). Such monsters get a cheaper turn (see Mon::on_actor_turn) - no target
+//selection or perception, and coarse steps (straight towards the leader or lair, or random
+//wandering) instead of path finding.
+//
+//A monster gets full detail turns again when it comes within the wake distance, and for a
+//while after it hears a sound, or a monster is spawned near it. Which detail is used only
+//depends on the game state, so a game is still the same for the same seed.
+namespace sim_lod
+{
+
+//Further than this from the player and the player's allies, monsters may get low detail
+//turns (this is beyond the distance they can see, with a margin for moving)
+const int WAKE_DIST = FOV_STD_RADI_INT + 4;
+
+//Number of turns a monster gets full detail after hearing a sound or a nearby spawn
+const int NR_TURNS_WOKEN = 10;
+
+bool is_low_detail(const Mon& mon);
+
+//Gives full detail turns to the monsters within the wake distance of the position
+void wake_near(const Pos& p);
+
+} //sim_lod
+
+#endif
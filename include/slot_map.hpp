@@ -0,0 +1,165 @@
+#ifndef SLOT_MAP_H
+#define SLOT_MAP_H
+
+#include <vector>
+#include <cassert>
+
+//Refers to an element in a Slot_map. The handle stays valid while the element is stored,
+//and is detected as stale after the element is erased (even if the slot is reused).
+struct Slot_handle
+{
+    Slot_handle() :
+        idx (-1),
+        gen (0) {}
+
+    bool operator==(const Slot_handle& other) const
+    {
+        return idx == other.idx && gen == other.gen;
+    }
+
+    int idx;
+    int gen;
+};
+
+//Pointers to objects, stored contiguously for iteration, with O(1) insertion and removal.
+//Removing an element moves the last element into its place, so the order is not kept.
+//
+//The stored type must have a public "Slot_handle handle" member, which is set on insertion.
+template<typename T>
+class Slot_map
+{
+public:
+    typedef typename std::vector<T*>::const_iterator const_iterator;
+
+    Slot_handle insert(T* const elem)
+    {
+        assert(elem);
+
+        int slot_idx = -1;
+
+        if (free_slots_.empty())
+        {
+            slot_idx = slots_.size();
+            slots_.push_back({0, 0});
+        }
+        else
+        {
+            slot_idx = free_slots_.back();
+            free_slots_.pop_back();
+        }
+
+        Slot& slot = slots_[slot_idx];
+
+        slot.dense_idx = dense_.size();
+
+        dense_.push_back(elem);
+        dense_slots_.push_back(slot_idx);
+
+        elem->handle.idx = slot_idx;
+        elem->handle.gen = slot.gen;
+
+        return elem->handle;
+    }
+
+    //Returns the element, or nullptr if it has been erased
+    T* get(const Slot_handle h) const
+    {
+        if (h.idx < 0 || h.idx >= int(slots_.size()) || slots_[h.idx].gen != h.gen)
+        {
+            return nullptr;
+        }
+
+        return dense_[slots_[h.idx].dense_idx];
+    }
+
+    //NOTE: The element is not deleted
+    void erase(T* const elem)
+    {
+        assert(get(elem->handle) == elem);
+
+        erase_at(slots_[elem->handle.idx].dense_idx);
+    }
+
+    //NOTE: The element is not deleted
+    void erase_at(const size_t dense_idx)
+    {
+        assert(dense_idx < dense_.size());
+
+        const int SLOT_IDX = dense_slots_[dense_idx];
+
+        //Move the last element into the erased position
+        dense_[dense_idx]       = dense_.back();
+        dense_slots_[dense_idx] = dense_slots_.back();
+
+        slots_[dense_slots_[dense_idx]].dense_idx = dense_idx;
+
+        dense_.pop_back();
+        dense_slots_.pop_back();
+
+        release_slot(SLOT_IDX);
+    }
+
+    //NOTE: The elements are not deleted
+    void clear()
+    {
+        for (const int SLOT_IDX : dense_slots_)
+        {
+            release_slot(SLOT_IDX);
+        }
+
+        dense_.clear();
+        dense_slots_.clear();
+    }
+
+    T* operator[](const size_t dense_idx) const
+    {
+        return dense_[dense_idx];
+    }
+
+    size_t size() const
+    {
+        return dense_.size();
+    }
+
+    bool empty() const
+    {
+        return dense_.empty();
+    }
+
+    const std::vector<T*>& elements() const
+    {
+        return dense_;
+    }
+
+    const_iterator begin() const
+    {
+        return dense_.begin();
+    }
+
+    const_iterator end() const
+    {
+        return dense_.end();
+    }
+
+private:
+    struct Slot
+    {
+        int gen;
+        int dense_idx;
+    };
+
+    void release_slot(const int SLOT_IDX)
+    {
+        //Any handles to the old element are now stale
+        ++slots_[SLOT_IDX].gen;
+
+        free_slots_.push_back(SLOT_IDX);
+    }
+
+    std::vector<T*>     dense_;
+    std::vector<int>    dense_slots_;
+    std::vector<Slot>   slots_;
+    std::vector<int>    free_slots_;
+};
+
+#endif
@@ -8,6 +8,7 @@
 #include "cmn_types.hpp"
 #include "properties.hpp"
 #include "player_bon.hpp"
+#include "alloc_tracking.hpp"
 
 class Actor;
 class Mon;
@@ -72,6 +73,8 @@ enum class Spell_effect_noticed {no, yes};
 class Spell
 {
 public:
+    ALLOC_TRACKED(Alloc_cat::spell)
+
     Spell() {}
     virtual ~Spell() {}
 
@@ -0,0 +1,81 @@
+#ifndef UNION_FIND_H
+#define UNION_FIND_H
+
+#include <vector>
+
+//Disjoint sets of the elements [0, N - 1] (union by size, with path halving). Finding the
+//set of an element, and merging two sets, are both practically constant time.
+class Union_find
+{
+public:
+    Union_find() {}
+
+    explicit Union_find(const int N)
+    {
+        reset(N);
+    }
+
+    //Puts every element in a set of its own
+    void reset(const int N)
+    {
+        parent_.resize(N);
+        size_.assign(N, 1);
+
+        for (int i = 0; i < N; ++i)
+        {
+            parent_[i] = i;
+        }
+    }
+
+    //Returns the representative element of the set containing the element
+    int find(int i)
+    {
+        while (parent_[i] != i)
+        {
+            parent_[i]  = parent_[parent_[i]];
+            i           = parent_[i];
+        }
+
+        return i;
+    }
+
+    //Returns true if the elements were in different sets (which are now merged)
+    bool unite(int a, int b)
+    {
+        a = find(a);
+        b = find(b);
+
+        if (a == b)
+        {
+            return false;
+        }
+
+        if (size_[a] < size_[b])
+        {
+            const int tmp = a;
+            a = b;
+            b = tmp;
+        }
+
+        parent_[b]  = a;
+        size_[a]   += size_[b];
+
+        return true;
+    }
+
+    bool is_same_set(const int A, const int B)
+    {
+        return find(A) == find(B);
+    }
+
+    int set_size(const int I)
+    {
+        return size_[find(I)];
+    }
+
+private:
+    std::vector<int> parent_;
+    std::vector<int> size_;
+};
+
+#endif
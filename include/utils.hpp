@@ -5,7 +5,7 @@
 
 #include "cmn_data.hpp"
 #include "cmn_types.hpp"
-#include "mersenne_twister.hpp"
+#include "rng.hpp"
 
 class Actor;
 class Mob;
@@ -13,11 +13,45 @@ class Mob;
 namespace rnd
 {
 
-//NOTE: If MTRand is not provided any parameters to the constructor, it will be seeded
-//with current time. So seeding it manually is not necessary for normal gameplay
-//purposes - only if seed should be controlled.
+//Each subsystem draws from its own stream, so that a change in how many numbers one of
+//them consumes does not perturb the rolls of the others (e.g. map generation is not
+//affected by how many times the ambient sounds were rolled before it).
+enum class Stream
+{
+    cmn,        //Anything not belonging to one of the streams below
+    mapgen,
+    ai,
+    combat,
+    loot,
+    cosmetic,   //Rolls which do not affect the game state (sounds, menu effects...)
+    END
+};
+
+//Makes the rnd functions below draw from the given stream while the object is alive, the
+//previous stream is restored on destruction (so scopes can be nested).
+class Stream_scope
+{
+public:
+    Stream_scope(const Stream stream);
+
+    ~Stream_scope();
+
+private:
+    Stream_scope(const Stream_scope&) = delete;
+    Stream_scope& operator=(const Stream_scope&) = delete;
+
+    const Stream prev_stream_;
+};
+
+//Seeds all streams - each stream starts 2^64 steps after the previous one in the sequence
+//of the given seed, so the streams do not overlap in practice.
+//NOTE: The streams are seeded from the current time when each thread starts. So seeding
+//manually is not necessary for normal gameplay purposes - only if seed should be controlled.
 void seed(const unsigned long val);
 
+//The generator of the given stream, e.g. for handing a separately seeded copy to a thread
+Rng& stream_rng(const Stream stream);
+
 int dice(const int ROLLS, const int SIDES);
 
 int dice(const Dice_param& p);
@@ -38,6 +72,16 @@ int percent();
 
 bool percent(const int PCT_CHANCE);
 
+//NOTE: Use this instead of std::random_shuffle, which draws from the C library rand() - that
+//sequence is shared by all threads and is not controlled by seed().
+template<typename T> void shuffle(std::vector<T>& v)
+{
+    for (int i = int(v.size()) - 1; i > 0; --i)
+    {
+        std::swap(v[i], v[range(0, i)]);
+    }
+}
+
 } //rnd
 
 enum class Time_type
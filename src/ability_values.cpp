@@ -11,6 +11,76 @@
 int Ability_vals::val(const Ability_id id,
                       const bool IS_AFFECTED_BY_PROPS,
                       const Actor& actor) const
+{
+    Ability_cache& cache = actor.ability_cache_;
+
+    if (!is_cache_valid(actor))
+    {
+        cache.vals          = this;
+        cache.vals_version  = version_;
+        cache.props_version = actor.prop_handler().version();
+
+        if (actor.is_player())
+        {
+            cache.bon_version   = player_bon::version();
+            cache.hp            = actor.hp_;
+            cache.hp_max        = actor.hp_max_;
+
+            for (const Inv_slot& slot : actor.inv().slots_)
+            {
+                cache.equipped[int(slot.id)] = slot.item ? &slot.item->data() : nullptr;
+            }
+        }
+
+        for (int i = 0; i < int(Ability_id::END); ++i)
+        {
+            cache.result[0][i] = calc_val(Ability_id(i), false, actor);
+            cache.result[1][i] = calc_val(Ability_id(i), true,  actor);
+        }
+    }
+
+    return cache.result[IS_AFFECTED_BY_PROPS ? 1 : 0][int(id)];
+}
+
+bool Ability_vals::is_cache_valid(const Actor& actor) const
+{
+    const Ability_cache& cache = actor.ability_cache_;
+
+    if (
+        cache.vals          != this     ||
+        cache.vals_version  != version_ ||
+        cache.props_version != actor.prop_handler().version())
+    {
+        return false;
+    }
+
+    if (actor.is_player())
+    {
+        if (
+            cache.bon_version   != player_bon::version()  ||
+            cache.hp            != actor.hp_              ||
+            cache.hp_max        != actor.hp_max_)
+        {
+            return false;
+        }
+
+        for (const Inv_slot& slot : actor.inv().slots_)
+        {
+            const Item_data_t* const d = slot.item ? &slot.item->data() : nullptr;
+
+            if (cache.equipped[int(slot.id)] != d)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int Ability_vals::calc_val(const Ability_id id,
+                           const bool IS_AFFECTED_BY_PROPS,
+                           const Actor& actor) const
 {
     int ret = ability_list[size_t(id)];
 
@@ -181,16 +251,22 @@ void Ability_vals::reset()
     {
         ability_list[i] = 0;
     }
+
+    ++version_;
 }
 
 void Ability_vals::set_val(const Ability_id ability, const int VAL)
 {
     ability_list[int(ability)] = VAL;
+
+    ++version_;
 }
 
 void Ability_vals::change_val(const Ability_id ability, const int CHANGE)
 {
     ability_list[int(ability)] += CHANGE;
+
+    ++version_;
 }
 
 namespace ability_roll
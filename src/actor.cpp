@@ -20,6 +20,7 @@
 #include "input.hpp"
 #include "marker.hpp"
 #include "look.hpp"
+#include "perception.hpp"
 
 Actor::Actor() :
     pos             (),
@@ -127,6 +128,11 @@ Actor_speed Actor::speed() const
 
 void Actor::seen_foes(std::vector<Actor*>& out)
 {
+    if (!is_player() && perception::seen_foes(*static_cast<const Mon*>(this), out))
+    {
+        return;
+    }
+
     out.clear();
 
     bool blocked_los[MAP_W][MAP_H];
@@ -693,12 +699,6 @@ void Actor::die(const bool IS_DESTROYED, const bool ALLOW_GORE, const bool ALLOW
 
     if (!is_player())
     {
-        //If this monster is player's target, unset the target
-        if (map::player->tgt_ == this)
-        {
-            map::player->tgt_ = nullptr;
-        }
-
         //Print death messages
         if (map::player->can_see_actor(*this))
         {
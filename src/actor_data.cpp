@@ -4,6 +4,7 @@
 
 #include <string>
 #include <vector>
+#include <algorithm>
 #include <math.h>
 
 #include "cmn_types.hpp"
@@ -74,11 +75,14 @@ void Actor_data_t::reset()
 namespace actor_data
 {
 
-Actor_data_t data[int(Actor_id::END)];
+thread_local Actor_data_t data[int(Actor_id::END)];
 
 namespace
 {
 
+//The data as it is at the start of a game, the same for all sessions (and threads)
+Actor_data_t base_data_[int(Actor_id::END)];
+
 void init_data_list()
 {
     Actor_data_t d;
@@ -96,7 +100,7 @@ void init_data_list()
     d.is_auto_spawn_allowed = false;
     d.actor_size = Actor_size::humanoid;
     d.is_humanoid = true;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Reanimated Corpse";
@@ -140,7 +144,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Reanimated Corpse";
@@ -184,7 +188,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Bloated Corpse";
@@ -227,7 +231,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "Major Clapham-Lee";
@@ -270,7 +274,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "Dean Halsey";
@@ -313,7 +317,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Cultist";
@@ -352,7 +356,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::human);
     d.native_rooms.push_back(Room_type::ritual);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Cultist";
@@ -392,7 +396,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::human);
     d.native_rooms.push_back(Room_type::ritual);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Cultist";
@@ -432,7 +436,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::human);
     d.native_rooms.push_back(Room_type::ritual);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "Keziah Mason";
@@ -482,7 +486,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::ritual);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "Brown Jenkin";
@@ -511,7 +515,7 @@ void init_data_list()
     d.nr_left_allowed_to_spawn = 0;
     d.is_unique = true;
     d.natural_props[int(Prop_id::infravis)] = true;
-    d.spawn_min_dLVL = data[int(Actor_id::keziah_mason)].spawn_min_dLVL;
+    d.spawn_min_dLVL = base_data_[int(Actor_id::keziah_mason)].spawn_min_dLVL;
     d.group_size = Mon_group_size::alone;
     d.actor_size = Actor_size::floor;
     d.descr = "\"That object - no larger than a good sized rat and quaintly "
@@ -533,7 +537,7 @@ void init_data_list()
     d.erratic_move_pct = Actor_erratic_freq::rare;
     d.mon_shock_lvl = Mon_shock_lvl::scary;
     d.is_rat = true;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "Elder Hierophant";
@@ -570,7 +574,7 @@ void init_data_list()
     d.nr_turns_aware = 999;
     d.erratic_move_pct = Actor_erratic_freq::never;
     d.mon_shock_lvl = Mon_shock_lvl::mind_shattering;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
 //  d.name_a = "The Lord of Pestilence";
@@ -626,7 +630,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::human);
     d.native_rooms.push_back(Room_type::ritual);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Green Spider";
@@ -662,7 +666,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::spider);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A White Spider";
@@ -698,7 +702,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::spider);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Red Spider";
@@ -734,7 +738,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::spider);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Shadow Spider";
@@ -772,7 +776,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::spider);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Leng Spider";
@@ -812,7 +816,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::spider);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Fire hound";
@@ -857,7 +861,7 @@ void init_data_list()
     d.can_be_summoned = true;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::monster);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Frost hound";
@@ -903,7 +907,7 @@ void init_data_list()
     d.can_be_summoned = true;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::monster);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "Zuul the Gatekeeper";
@@ -955,7 +959,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::human);
     d.native_rooms.push_back(Room_type::ritual);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Ghost";
@@ -998,7 +1002,7 @@ void init_data_list()
     d.death_msg_override = "The Ghost is put to rest.";
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Phantasm";
@@ -1043,7 +1047,7 @@ void init_data_list()
     d.death_msg_override = "The Phantasm is put to rest.";
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Wraith";
@@ -1088,7 +1092,7 @@ void init_data_list()
     d.death_msg_override = "The Wraith is put to rest.";
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Rat";
@@ -1125,7 +1129,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::human);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Rat-thing";
@@ -1170,7 +1174,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::human);
     d.native_rooms.push_back(Room_type::crypt);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Wolf";
@@ -1211,7 +1215,7 @@ void init_data_list()
     d.can_be_summoned = true;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Giant Bat";
@@ -1253,7 +1257,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::forest);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Byakhee";
@@ -1302,7 +1306,7 @@ void init_data_list()
     d.can_be_summoned = true;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Giant Mantis";
@@ -1340,7 +1344,7 @@ void init_data_list()
     d.can_be_summoned = false;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Giant Locust";
@@ -1378,7 +1382,7 @@ void init_data_list()
     d.can_bleed = false;
     d.can_be_summoned = false;
     d.native_rooms.push_back(Room_type::plain);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Fungi from Yuggoth";
@@ -1439,7 +1443,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::forest);
     d.native_rooms.push_back(Room_type::cave);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Mi-go Commander";
@@ -1472,7 +1476,7 @@ void init_data_list()
     d.can_bash_doors = true;
     d.can_open_doors = true;
     d.nr_turns_aware = 12;
-    d.descr = data[size_t(Actor_id::mi_go)].descr;
+    d.descr = base_data_[size_t(Actor_id::mi_go)].descr;
     d.spell_cast_msg = d.name_the + " makes strange gestures in the air.";
     d.aggro_text_mon_seen = d.name_the + " speaks at me in a droning voice.";
     d.aggro_text_mon_hidden = "I hear a droning voice.";
@@ -1483,7 +1487,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::forest);
     d.native_rooms.push_back(Room_type::cave);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Flying Polyp";
@@ -1541,7 +1545,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::cave);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Greater Polyp";
@@ -1584,7 +1588,7 @@ void init_data_list()
     d.can_bash_doors = false;
     d.can_open_doors = false;
     d.nr_turns_aware = 6;
-    d.descr = data[size_t(Actor_id::flying_polyp)].descr;
+    d.descr = base_data_[size_t(Actor_id::flying_polyp)].descr;
     d.aggro_text_mon_seen = d.name_the + " makes shrill whistling sounds.";
     d.aggro_text_mon_hidden = "I hear a shrill whistling.";
     d.erratic_move_pct = Actor_erratic_freq::very;
@@ -1593,7 +1597,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::cave);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Ghoul";
@@ -1642,7 +1646,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::crypt);
     d.native_rooms.push_back(Room_type::cave);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Shadow";
@@ -1688,7 +1692,7 @@ void init_data_list()
     d.mon_shock_lvl = Mon_shock_lvl::scary;
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::plain);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Mummy";
@@ -1728,7 +1732,7 @@ void init_data_list()
     d.is_infra_visible = false;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::cave);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Crocodile Head Mummy";
@@ -1769,7 +1773,7 @@ void init_data_list()
     d.is_infra_visible = false;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::cave);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "Khephren";
@@ -1813,7 +1817,7 @@ void init_data_list()
     d.is_humanoid = true;
     d.is_infra_visible = false;
     d.native_rooms.push_back(Room_type::plain);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "Nitokris";
@@ -1860,7 +1864,7 @@ void init_data_list()
     d.is_infra_visible = false;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::cave);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Deep One";
@@ -1905,7 +1909,7 @@ void init_data_list()
     d.mon_shock_lvl = Mon_shock_lvl::scary;
     d.native_rooms.push_back(Room_type::flooded);
     d.native_rooms.push_back(Room_type::muddy);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Carnivorous Ape";
@@ -1950,7 +1954,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::forest);
     d.native_rooms.push_back(Room_type::cave);
     d.native_rooms.push_back(Room_type::monster);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Worm Mass";
@@ -1988,7 +1992,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::monster);
     d.native_rooms.push_back(Room_type::cave);
     d.native_rooms.push_back(Room_type::forest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Dust Vortex";
@@ -2034,7 +2038,7 @@ void init_data_list()
     d.mon_shock_lvl = Mon_shock_lvl::unsettling;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::cave);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Fire Vortex";
@@ -2079,7 +2083,7 @@ void init_data_list()
     d.mon_shock_lvl = Mon_shock_lvl::unsettling;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::cave);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Frost Vortex";
@@ -2125,7 +2129,7 @@ void init_data_list()
     d.mon_shock_lvl = Mon_shock_lvl::unsettling;
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::cave);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Black Ooze";
@@ -2177,7 +2181,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::flooded);
     d.native_rooms.push_back(Room_type::muddy);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Clear Ooze";
@@ -2230,7 +2234,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::flooded);
     d.native_rooms.push_back(Room_type::muddy);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Putrid Ooze";
@@ -2283,7 +2287,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::flooded);
     d.native_rooms.push_back(Room_type::muddy);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Poison Ooze";
@@ -2336,7 +2340,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::flooded);
     d.native_rooms.push_back(Room_type::muddy);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Colour out of space";
@@ -2385,7 +2389,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::flooded);
     d.native_rooms.push_back(Room_type::muddy);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Chthonian";
@@ -2433,7 +2437,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::plain);
     d.native_rooms.push_back(Room_type::cave);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Sentry Drone";
@@ -2485,7 +2489,7 @@ void init_data_list()
     d.erratic_move_pct = Actor_erratic_freq::rare;
     d.mon_shock_lvl = Mon_shock_lvl::unsettling;
     d.native_rooms.push_back(Room_type::plain);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.id = Actor_id::mold;
@@ -2528,7 +2532,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::muddy);
     d.native_rooms.push_back(Room_type::forest);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "Gas Spore";
@@ -2574,7 +2578,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::muddy);
     d.native_rooms.push_back(Room_type::forest);
     d.native_rooms.push_back(Room_type::chasm);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Hunting Horror";
@@ -2626,7 +2630,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::cave);
     d.native_rooms.push_back(Room_type::chasm);
     d.erratic_move_pct = Actor_erratic_freq::somewhat;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "A Death Fiend";
@@ -2678,7 +2682,7 @@ void init_data_list()
     d.native_rooms.push_back(Room_type::cave);
     d.native_rooms.push_back(Room_type::chasm);
     d.erratic_move_pct = Actor_erratic_freq::rare;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
     d.name_a = "The High Priest";
@@ -2726,13 +2730,13 @@ void init_data_list()
     d.is_humanoid = true;
     d.can_leave_corpse = false;
     d.can_bleed = false;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 
-    d = data[size_t(Actor_id::the_high_priest)]; // NOTE: Copy of The High Priest
+    d = base_data_[size_t(Actor_id::the_high_priest)]; // NOTE: Copy of The High Priest
     d.id = Actor_id::the_high_priest_cpy;
     d.death_msg_override = "The Copy vanishes.";
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
     d.reset();
 }
 
@@ -2741,7 +2745,15 @@ void init_data_list()
 void init()
 {
     TRACE_FUNC_BEGIN;
-    init_data_list();
+
+    //Building the data list is slow, so it is only done once per process. Each session
+    //gets a copy, which is modified during the game (e.g. the kill counts).
+    static const bool IS_BASE_DATA_BUILT = (init_data_list(), true);
+
+    (void)IS_BASE_DATA_BUILT;
+
+    std::copy(std::begin(base_data_), std::end(base_data_), std::begin(data));
+
     TRACE_FUNC_END;
 }
 
@@ -11,6 +11,7 @@
 #include "utils.hpp"
 #include "actor.hpp"
 #include "feature_rigid.hpp"
+#include "sim_lod.hpp"
 
 using namespace std;
 
@@ -231,19 +232,20 @@ Actor* mk(const Actor_id id, const Pos& pos)
 
     game_time::add_actor(actor);
 
+    //Monsters near a spawn should react to it in full detail
+    sim_lod::wake_near(pos);
+
     return actor;
 }
 
 void delete_all_mon()
 {
-    vector<Actor*>& actors = game_time::actors_;
-
-    for (size_t i = 0; i < actors.size(); ++i)
+    //Erasing from the back, so only already checked actors are moved into erased elements
+    for (int i = int(game_time::actors_.size()) - 1; i >= 0; --i)
     {
-        if (actors[i] != map::player)
+        if (game_time::actors_[i] != map::player)
         {
             game_time::erase_actor_in_element(i);
-            --i;
         }
     }
 }
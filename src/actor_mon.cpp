@@ -28,6 +28,8 @@
 #include "explosion.hpp"
 #include "popup.hpp"
 #include "fov.hpp"
+#include "profiler.hpp"
+#include "sim_lod.hpp"
 
 Mon::Mon() :
     Actor                       (),
@@ -43,7 +45,8 @@ Mon::Mon() :
     waiting_                    (false),
     shock_caused_cur_           (0.0),
     has_given_xp_for_spotting_  (false),
-    nr_turns_until_unsummoned_  (-1) {}
+    nr_turns_until_unsummoned_  (-1),
+    nr_turns_full_detail_       (0) {}
 
 Mon::~Mon()
 {
@@ -55,6 +58,8 @@ Mon::~Mon()
 
 void Mon::on_actor_turn()
 {
+    PROFILE_SCOPE("Mon::on_actor_turn");
+
 #ifndef NDEBUG
     //Sanity check - verify that monster is not outside the map
     if (!utils::is_pos_inside_map(pos, false))
@@ -73,6 +78,13 @@ void Mon::on_actor_turn()
     }
 #endif // NDEBUG
 
+    rnd::Stream_scope rnd_scope(rnd::Stream::ai);
+
+    if (nr_turns_full_detail_ > 0)
+    {
+        --nr_turns_full_detail_;
+    }
+
     if (aware_counter_ <= 0 && !is_actor_my_leader(map::player))
     {
         waiting_ = !waiting_;
@@ -88,13 +100,19 @@ void Mon::on_actor_turn()
         waiting_ = false;
     }
 
+    if (sim_lod::is_low_detail(*this))
+    {
+        act_low_detail();
+        return;
+    }
+
     //Pick a target
     std::vector<Actor*> tgt_bucket;
 
     if (prop_handler_->has_prop(Prop_id::conflict))
     {
         //Monster is conflicted (e.g. by player ring/amulet)
-        tgt_bucket = game_time::actors_;
+        tgt_bucket = game_time::actors_.elements();
 
         bool hard_blocked_los[MAP_W][MAP_H];
 
@@ -462,10 +480,57 @@ void Mon::move(Dir dir)
     game_time::tick();
 }
 
+void Mon::act_low_detail()
+{
+    PROFILE_SCOPE("Mon::act_low_detail");
+
+    tgt_ = nullptr;
+
+    if (spell_cool_down_cur_ != 0) {spell_cool_down_cur_--;}
+
+    //Nobody on the player's side can see the monster here
+    is_sneaking_ = ability(Ability_id::stealth, true) > 0;
+
+    if (on_actor_turn_hook())
+    {
+        return;
+    }
+
+    //Keep up with the leader, or return to the lair
+    if (data_->ai[size_t(Ai_id::moves_to_leader)] && leader_ && leader_->is_alive())
+    {
+        if (
+            utils::king_dist(pos, leader_->pos) > 2 &&
+            ai::action::step_straight_towards(*this, leader_->pos))
+        {
+            return;
+        }
+    }
+    else if (data_->ai[size_t(Ai_id::moves_to_lair)])
+    {
+        if (ai::action::step_straight_towards(*this, lair_cell_))
+        {
+            return;
+        }
+    }
+
+    if (data_->ai[size_t(Ai_id::moves_to_random_when_unaware)])
+    {
+        if (ai::action::move_to_random_adj_cell(*this))
+        {
+            return;
+        }
+    }
+
+    game_time::tick();
+}
+
 void Mon::hear_sound(const Snd& snd)
 {
     if (is_alive())
     {
+        nr_turns_full_detail_ = sim_lod::NR_TURNS_WOKEN;
+
         if (snd.is_alerting_mon())
         {
             become_aware(false);
@@ -561,10 +626,11 @@ bool Mon::try_attack(Actor& defender)
 
         if (rnd::fraction(4, 5))
         {
-            std::vector<Pos> line;
-            line_calc::calc_new_line(pos, defender.pos, true, 9999, false, line);
+            line_calc::Line_iter line(pos, defender.pos, true, 9999, false);
+
+            Pos line_pos;
 
-            for (Pos& line_pos : line)
+            while (line.next(line_pos))
             {
                 if (line_pos != pos && line_pos != defender.pos)
                 {
@@ -1,5 +1,8 @@
 #include "actor_player.hpp"
 
+#include <algorithm>
+#include <climits>
+
 #include "init.hpp"
 #include "render.hpp"
 #include "audio.hpp"
@@ -40,7 +43,6 @@ Player::Player() :
     Actor(),
     active_medical_bag          (nullptr),
     active_explosive            (nullptr),
-    tgt_                        (nullptr),
     wait_turns_left             (-1),
     ins_                        (0),
     shock_                      (0.0),
@@ -50,6 +52,12 @@ Player::Player() :
     nr_turns_until_ins_         (-1),
     nr_quick_move_steps_left_   (-1),
     quick_move_dir_             (Dir::END),
+    travel_path_                (),
+    is_exploring_               (false),
+    is_opening_door_on_route_   (false),
+    explore_dests_              (),
+    seen_cells_                 (),
+    unmemorized_cells_          (),
     CARRY_WEIGHT_BASE_          (450)
 {
     for (int i = 0; i < int(Phobia::END); ++i)
@@ -61,6 +69,14 @@ Player::Player() :
     {
         obsessions[i] = false;
     }
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            is_unmemorized_[x][y] = false;
+        }
+    }
 }
 
 Player::~Player()
@@ -71,6 +87,16 @@ Player::~Player()
     }
 }
 
+Actor* Player::tgt() const
+{
+    return game_time::actors_.get(tgt_);
+}
+
+void Player::set_tgt(Actor* const actor)
+{
+    tgt_ = actor ? actor->handle : Slot_handle();
+}
+
 void Player::mk_start_items()
 {
     data_->ability_vals.reset();
@@ -384,6 +410,8 @@ void Player::on_hit(int& dmg)
         incr_shock(1, Shock_src::misc);
     }
 
+    stop_auto_move();
+
     render::draw_map_and_interface();
 }
 
@@ -975,9 +1003,141 @@ void Player::set_quick_move(const Dir dir)
     quick_move_dir_         = dir;
 }
 
+void Player::travel_blocked(bool out[MAP_W][MAP_H]) const
+{
+    map_parse::run(cell_check::Blocks_move_cmn(false), out);
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            const Cell&         cell    = map::cells[x][y];
+            const Rigid* const  rigid   = cell.rigid;
+
+            if (!cell.is_explored)
+            {
+                out[x][y] = true;
+            }
+            else if (rigid->id() == Feature_id::door)
+            {
+                //Closed doors are opened on the way (unless not known to be doors)
+                out[x][y] = static_cast<const Door*>(rigid)->is_secret();
+            }
+            else if (rigid->id() == Feature_id::trap)
+            {
+                out[x][y] = out[x][y] || !static_cast<const Trap*>(rigid)->is_hidden();
+            }
+            else if (rigid->burn_state() == Burn_state::burning)
+            {
+                out[x][y] = true;
+            }
+        }
+    }
+}
+
+void Player::travel_to(const Pos& p)
+{
+    stop_auto_move();
+
+    if (p == pos)
+    {
+        return;
+    }
+
+    bool blocked[MAP_W][MAP_H];
+    travel_blocked(blocked);
+
+    if (!blocked[p.x][p.y])
+    {
+        path_find::run(pos, p, blocked, travel_path_);
+    }
+
+    if (travel_path_.empty())
+    {
+        msg_log::add("I know no way there.");
+    }
+}
+
+void Player::explore()
+{
+    stop_auto_move();
+
+    is_exploring_ = true;
+}
+
+bool Player::mk_explore_path()
+{
+    bool blocked[MAP_W][MAP_H];
+    travel_blocked(blocked);
+
+    int flood[MAP_W][MAP_H];
+    flood_fill::run(pos, blocked, flood, INT_MAX, Pos(-1, -1), true);
+
+    //The nearest reachable cell next to an unexplored cell (dark cells are never explored,
+    //so they are not counted)
+    Pos dest(-1, -1);
+
+    for (int x = 1; x < MAP_W - 1; ++x)
+    {
+        for (int y = 1; y < MAP_H - 1; ++y)
+        {
+            const int DIST = flood[x][y];
+
+            if (DIST == 0 || (dest.x >= 0 && DIST >= flood[dest.x][dest.y]))
+            {
+                continue;
+            }
+
+            const Pos p(x, y);
+
+            bool is_next_to_unexplored = false;
+
+            for (const Pos& d : dir_utils::dir_list)
+            {
+                const Cell& adj_cell = map::cells[x + d.x][y + d.y];
+
+                if (!adj_cell.is_explored && !adj_cell.is_dark)
+                {
+                    is_next_to_unexplored = true;
+                    break;
+                }
+            }
+
+            if (
+                is_next_to_unexplored &&
+                find(begin(explore_dests_), end(explore_dests_), p) == end(explore_dests_))
+            {
+                dest = p;
+            }
+        }
+    }
+
+    if (dest.x < 0)
+    {
+        return false;
+    }
+
+    explore_dests_.push_back(dest);
+
+    path_find::run(pos, dest, blocked, travel_path_);
+
+    return !travel_path_.empty();
+}
+
+void Player::stop_auto_move()
+{
+    travel_path_.clear();
+    is_exploring_ = false;
+    explore_dests_.clear();
+}
+
 void Player::on_actor_turn()
 {
-    render::draw_map_and_interface();
+    //While travelling or exploring, the map is drawn when the player stops
+    if (!is_auto_moving())
+    {
+        render::draw_map_and_interface();
+    }
 
     reset_perm_shock_taken_cur_turn();
 
@@ -999,9 +1159,9 @@ void Player::on_actor_turn()
         return;
     }
 
-    if (tgt_ && tgt_->state() != Actor_state::alive)
+    if (tgt() && tgt()->state() != Actor_state::alive)
     {
-        tgt_ = nullptr;
+        set_tgt(nullptr);
     }
 
     //Check if we should go back to inventory screen
@@ -1068,6 +1228,64 @@ void Player::on_actor_turn()
         }
     }
 
+    //Travel and explore
+    if (is_exploring_ && travel_path_.empty() && !mk_explore_path())
+    {
+        stop_auto_move();
+
+        msg_log::add("There is nothing more to explore here.");
+    }
+
+    if (!travel_path_.empty())
+    {
+        //NOTE: The route only needs to be checked for things which can have changed since it
+        //was made - new messages (e.g. about items) interrupt the player anyway.
+        const Pos dest_pos = travel_path_.back();
+
+        const Rigid* const tgt_rigid = map::cells[dest_pos.x][dest_pos.y].rigid;
+
+        const bool IS_TGT_KNOWN_TRAP = tgt_rigid->id() == Feature_id::trap &&
+                                       !static_cast<const Trap*>(tgt_rigid)->is_hidden();
+
+        const bool SHOULD_ABORT = !utils::is_pos_adj(pos, dest_pos, false)          ||
+                                  IS_TGT_KNOWN_TRAP                                 ||
+                                  tgt_rigid->burn_state() == Burn_state::burning;
+
+        if (SHOULD_ABORT)
+        {
+            stop_auto_move();
+        }
+        else
+        {
+            //Moving into a closed door opens it, then the door cell is entered next turn
+            const bool IS_TGT_CLOSED_DOOR =
+                tgt_rigid->id() == Feature_id::door &&
+                !static_cast<const Door*>(tgt_rigid)->is_open();
+
+            is_opening_door_on_route_ = IS_TGT_CLOSED_DOOR;
+
+            move(dir_utils::dir(dest_pos - pos));
+
+            is_opening_door_on_route_ = false;
+
+            if (pos == dest_pos)
+            {
+                //NOTE: The route may have been cleared by a message while moving
+                if (!travel_path_.empty())
+                {
+                    travel_path_.pop_back();
+                }
+            }
+            else if (!IS_TGT_CLOSED_DOOR || !static_cast<const Door*>(tgt_rigid)->is_open())
+            {
+                //Blocked, or the door did not open
+                stop_auto_move();
+            }
+
+            return;
+        }
+    }
+
     //If this point is reached - read input from player
     if (config::is_bot_playing())
     {
@@ -1276,9 +1494,10 @@ void Player::on_std_turn()
                 if (!mon.is_msg_mon_in_view_printed_)
                 {
                     if (
-                        active_medical_bag    ||
-                        wait_turns_left > 0   ||
-                        nr_quick_move_steps_left_ > 0)
+                        active_medical_bag              ||
+                        wait_turns_left > 0             ||
+                        nr_quick_move_steps_left_ > 0   ||
+                        is_auto_moving())
                     {
                         msg_log::add(actor->name_a() + " comes into my view.", clr_white,
                                      true);
@@ -1415,6 +1634,12 @@ void Player::on_log_msg_printed()
     //Abort quick move
     nr_quick_move_steps_left_ = -1;
     quick_move_dir_ = Dir::END;
+
+    //Abort travel and explore (except for the message about opening a door on the route)
+    if (!is_opening_door_on_route_)
+    {
+        stop_auto_move();
+    }
 }
 
 void Player::interrupt_actions()
@@ -1444,6 +1669,9 @@ void Player::interrupt_actions()
     //Abort quick move
     nr_quick_move_steps_left_ = -1;
     quick_move_dir_         = Dir::END;
+
+    //Abort travel and explore
+    stop_auto_move();
 }
 
 void Player::hear_sound(const Snd& snd,
@@ -1546,7 +1774,7 @@ void Player::move(Dir dir)
                         }
 
                         attack::melee(this, pos, *mon_at_dest, *wpn);
-                        tgt_ = mon_at_dest;
+                        set_tgt(mon_at_dest);
                         return;
                     }
                 }
@@ -1673,13 +1901,15 @@ void Player::move(Dir dir)
 
 void Player::auto_melee()
 {
+    Actor* const cur_tgt = tgt();
+
     if (
-        tgt_                                        &&
-        tgt_->state() == Actor_state::alive         &&
-        utils::is_pos_adj(pos, tgt_->pos, false)    &&
-        can_see_actor(*tgt_))
+        cur_tgt                                         &&
+        cur_tgt->state() == Actor_state::alive          &&
+        utils::is_pos_adj(pos, cur_tgt->pos, false)     &&
+        can_see_actor(*cur_tgt))
     {
-        move(dir_utils::dir(tgt_->pos - pos));
+        move(dir_utils::dir(cur_tgt->pos - pos));
         return;
     }
 
@@ -1690,7 +1920,7 @@ void Player::auto_melee()
 
         if (actor && !is_leader_of(actor) && can_see_actor(*actor))
         {
-            tgt_ = actor;
+            set_tgt(actor);
             move(dir_utils::dir(d));
             return;
         }
@@ -1858,23 +2088,50 @@ void Player::update_fov()
         }
     }
 
-    //Explore
+    //Explore, and store the seen cells
+    seen_cells_.clear();
+
     for (int x = 0; x < MAP_W; ++x)
     {
         for (int y = 0; y < MAP_H; ++y)
         {
             Cell& cell = map::cells[x][y];
-            const bool IS_BLOCKING = cell_check::Blocks_move_cmn(false).check(cell);
 
-            //Do not explore dark floor cells
-            if (cell.is_seen_by_player && (!cell.is_dark || IS_BLOCKING))
+            if (cell.is_seen_by_player)
             {
-                cell.is_explored = true;
+                seen_cells_.push_back(Pos(x, y));
+
+                mark_unmemorized(Pos(x, y));
+
+                //Do not explore dark floor cells
+                if (!cell.is_dark || !(map::cell_traits[x][y] & feature_trait::can_move_cmn))
+                {
+                    cell.is_explored = true;
+                }
             }
         }
     }
 }
 
+void Player::mark_unmemorized(const Pos& p)
+{
+    if (!is_unmemorized_[p.x][p.y])
+    {
+        is_unmemorized_[p.x][p.y] = true;
+        unmemorized_cells_.push_back(p);
+    }
+}
+
+void Player::on_cells_memorized()
+{
+    for (const Pos& p : unmemorized_cells_)
+    {
+        is_unmemorized_[p.x][p.y] = false;
+    }
+
+    unmemorized_cells_.clear();
+}
+
 void Player::fov_hack()
 {
     bool blocked_los[MAP_W][MAP_H];
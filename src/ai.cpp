@@ -31,7 +31,7 @@ bool try_cast_random_spell(Mon& mon)
 
     std::vector<Spell*> spell_bucket = mon.spells_known_;
 
-    std::random_shuffle(begin(spell_bucket), end(spell_bucket));
+    rnd::shuffle(spell_bucket);
 
     while (!spell_bucket.empty())
     {
@@ -133,10 +133,11 @@ namespace
 //Check if acting monster is on a line between player and other monster
 bool check_if_blocking_mon(const Pos& pos, Mon& other)
 {
-    std::vector<Pos> line;
-    line_calc::calc_new_line(other.pos, map::player->pos, true, 9999, false, line);
+    line_calc::Line_iter line(other.pos, map::player->pos, true, 9999, false);
 
-    for (const Pos& pos_in_line : line) {if (pos_in_line == pos) {return true;}}
+    Pos pos_in_line;
+
+    while (line.next(pos_in_line)) {if (pos_in_line == pos) {return true;}}
 
     return false;
 }
@@ -460,6 +461,46 @@ bool step_to_lair_if_los(Mon& mon, const Pos& lair_p)
     return false;
 }
 
+bool step_straight_towards(Mon& mon, const Pos& p)
+{
+    if (!mon.is_alive() || p == mon.pos)
+    {
+        return false;
+    }
+
+    const Pos new_pos(mon.pos + (p - mon.pos).signs());
+
+    cell_check::Blocks_actor cellcheck(mon, true);
+
+    if (cellcheck.check(map::cells[new_pos.x][new_pos.y]))
+    {
+        return false;
+    }
+
+    for (Actor* actor : game_time::actors_)
+    {
+        if (actor->pos == new_pos)
+        {
+            return false;
+        }
+    }
+
+    std::vector<Mob*> mobs;
+    game_time::mobs_at_pos(new_pos, mobs);
+
+    for (Mob* mob : mobs)
+    {
+        if (cellcheck.check(*mob))
+        {
+            return false;
+        }
+    }
+
+    mon.move(dir_utils::dir(new_pos - mon.pos));
+
+    return true;
+}
+
 } //Action
 
 namespace info
@@ -0,0 +1,166 @@
+#include "alloc_tracking.hpp"
+
+#ifdef ALLOC_TRACKING
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace alloc_tracking
+{
+
+namespace
+{
+
+thread_local Alloc_stats    stats_[int(Alloc_cat::END)];
+thread_local FILE*          csv_        = nullptr;
+thread_local int            cur_dlvl_   = 0;
+
+} //namespace
+
+void* alloc(const Alloc_cat cat, const std::size_t size)
+{
+    Alloc_stats& s = stats_[int(cat)];
+
+    ++s.nr_allocs;
+    ++s.nr_live;
+
+    s.bytes_allocd  += size;
+    s.live_bytes    += size;
+
+    s.peak_nr_live      = std::max(s.peak_nr_live,    s.nr_live);
+    s.peak_live_bytes   = std::max(s.peak_live_bytes, s.live_bytes);
+
+    return ::operator new(size);
+}
+
+void free(const Alloc_cat cat, void* const ptr, const std::size_t size)
+{
+    if (!ptr)
+    {
+        return;
+    }
+
+    Alloc_stats& s = stats_[int(cat)];
+
+    ++s.nr_frees;
+    --s.nr_live;
+
+    s.live_bytes -= size;
+
+    ::operator delete(ptr);
+}
+
+const Alloc_stats& stats(const Alloc_cat cat)
+{
+    assert(cat != Alloc_cat::END);
+
+    return stats_[int(cat)];
+}
+
+const char* cat_name(const Alloc_cat cat)
+{
+    switch (cat)
+    {
+    case Alloc_cat::item:               return "item";
+    case Alloc_cat::actor:              return "actor";
+    case Alloc_cat::prop:               return "prop";
+    case Alloc_cat::rigid:              return "rigid";
+    case Alloc_cat::mob:                return "mob";
+    case Alloc_cat::room:               return "room";
+    case Alloc_cat::projectile:         return "projectile";
+    case Alloc_cat::ranged_att_data:    return "ranged_att_data";
+    case Alloc_cat::spell:              return "spell";
+    case Alloc_cat::END:                break;
+    }
+
+    assert(false);
+
+    return "";
+}
+
+void reset_period()
+{
+    for (Alloc_stats& s : stats_)
+    {
+        s.nr_allocs         = 0;
+        s.nr_frees          = 0;
+        s.bytes_allocd      = 0;
+        s.peak_nr_live      = s.nr_live;
+        s.peak_live_bytes   = s.live_bytes;
+    }
+}
+
+void print_report(FILE* const f)
+{
+    fprintf(f, "    %-16s %10s %10s %12s %10s %12s\n",
+            "category", "allocs", "frees", "bytes", "peak live", "peak bytes");
+
+    for (int i = 0; i < int(Alloc_cat::END); ++i)
+    {
+        const Alloc_stats& s = stats_[i];
+
+        if (s.nr_allocs == 0 && s.peak_nr_live == 0)
+        {
+            continue;
+        }
+
+        fprintf(f, "    %-16s %10lld %10lld %12lld %10lld %12lld\n",
+                cat_name(Alloc_cat(i)), s.nr_allocs, s.nr_frees, s.bytes_allocd,
+                s.peak_nr_live, s.peak_live_bytes);
+    }
+}
+
+void init(const char* const csv_path)
+{
+    assert(!csv_);
+
+    csv_ = fopen(csv_path, "w");
+
+    if (!csv_)
+    {
+        TRACE << "Failed to open allocation tracking file: " << csv_path << std::endl;
+        return;
+    }
+
+    fprintf(csv_, "dlvl,category,allocs,frees,bytes,peak_live,peak_bytes\n");
+
+    reset_period();
+}
+
+void cleanup()
+{
+    if (csv_)
+    {
+        on_new_lvl(cur_dlvl_);
+
+        fclose(csv_);
+
+        csv_ = nullptr;
+    }
+}
+
+void on_new_lvl(const int DLVL)
+{
+    if (csv_)
+    {
+        for (int i = 0; i < int(Alloc_cat::END); ++i)
+        {
+            const Alloc_stats& s = stats_[i];
+
+            fprintf(csv_, "%d,%s,%lld,%lld,%lld,%lld,%lld\n",
+                    cur_dlvl_, cat_name(Alloc_cat(i)), s.nr_allocs, s.nr_frees,
+                    s.bytes_allocd, s.peak_nr_live, s.peak_live_bytes);
+        }
+
+        fflush(csv_);
+    }
+
+    cur_dlvl_ = DLVL;
+
+    reset_period();
+}
+
+} //alloc_tracking
+
+#endif //ALLOC_TRACKING
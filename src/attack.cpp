@@ -515,21 +515,39 @@ namespace attack
 namespace
 {
 
-void print_melee_msg_and_mk_snd(const Melee_att_data& att_data, const Wpn& wpn)
+bool is_melee_hit(const Melee_att_data& att_data)
 {
-    assert(att_data.defender);
-
-    std::string other_name = "";
+    return !att_data.is_defender_dodging                &&
+           att_data.attack_result >= success_small      &&
+           !att_data.is_ethereal_defender_missed;
+}
 
-    auto snd_alerts_mon = Alerts_mon::no;
+//Determines the relative "size" of a hit
+Melee_hit_size melee_hit_size(const Melee_att_data& att_data, const Wpn& wpn)
+{
+    const auto& wpn_dmg  = wpn.data().melee.dmg;
+    const int   MAX_DMG = (wpn_dmg.first * wpn_dmg.second) + wpn.melee_dmg_plus_;
 
-    if ((int(wpn.data().weight) > int(Item_weight::light)) && !att_data.is_intrinsic_att)
+    if (MAX_DMG >= 4)
     {
-        snd_alerts_mon = Alerts_mon::yes;
+        if (att_data.dmg > (MAX_DMG * 5) / 6)
+        {
+            return Melee_hit_size::hard;
+        }
+        else if (att_data.dmg >  MAX_DMG / 2)
+        {
+            return Melee_hit_size::medium;
+        }
     }
 
-    //TODO: This message is not always appropriate (e.g. spear traps)
-    const std::string snd_msg = "I hear fighting.";
+    return Melee_hit_size::small;
+}
+
+void print_melee_msgs(const Melee_att_data& att_data, const Wpn& wpn)
+{
+    assert(att_data.defender);
+
+    std::string other_name = "";
 
     if (att_data.is_defender_dodging)
     {
@@ -584,11 +602,6 @@ void print_melee_msg_and_mk_snd(const Melee_att_data& att_data, const Wpn& wpn)
                 }
             }
         }
-
-        Snd snd(snd_msg, wpn.data().melee.miss_sfx, Ignore_msg_if_origin_seen::yes,
-                att_data.defender->pos, att_data.attacker, Snd_vol::low, snd_alerts_mon);
-
-        snd_emit::emit_snd(snd);
     }
     else if (att_data.attack_result <= fail_small)
     {
@@ -635,11 +648,6 @@ void print_melee_msg_and_mk_snd(const Melee_att_data& att_data, const Wpn& wpn)
                 }
             }
         };
-
-        Snd snd(snd_msg, wpn.data().melee.miss_sfx, Ignore_msg_if_origin_seen::yes,
-                att_data.defender->pos, att_data.attacker, Snd_vol::low, snd_alerts_mon);
-
-        snd_emit::emit_snd(snd);
     }
     else //Aim is ok
     {
@@ -676,37 +684,14 @@ void print_melee_msg_and_mk_snd(const Melee_att_data& att_data, const Wpn& wpn)
                                  clr_msg_good);
                 }
             }
-
-            Snd snd(snd_msg, wpn.data().melee.miss_sfx, Ignore_msg_if_origin_seen::yes,
-                    att_data.defender->pos, att_data.attacker, Snd_vol::low, snd_alerts_mon);
-
-            snd_emit::emit_snd(snd);
         }
         else //Target was hit (not ethereal)
         {
             //---------------------------------------------------------- ATTACK HITS TARGET
-            //Determine the relative "size" of the hit
-            const auto& wpn_dmg  = wpn.data().melee.dmg;
-            const int   MAX_DMG = (wpn_dmg.first * wpn_dmg.second) + wpn.melee_dmg_plus_;
-
-            Melee_hit_size hit_size = Melee_hit_size::small;
-
-            if (MAX_DMG >= 4)
-            {
-                if (att_data.dmg > (MAX_DMG * 5) / 6)
-                {
-                    hit_size = Melee_hit_size::hard;
-                }
-                else if (att_data.dmg >  MAX_DMG / 2)
-                {
-                    hit_size = Melee_hit_size::medium;
-                }
-            }
-
             //Punctuation depends on attack strength
             std::string dmg_punct = ".";
 
-            switch (hit_size)
+            switch (melee_hit_size(att_data, wpn))
             {
             case Melee_hit_size::small:
                 break;
@@ -796,35 +781,53 @@ void print_melee_msg_and_mk_snd(const Melee_att_data& att_data, const Wpn& wpn)
                     }
                 }
             }
+        }
+    }
+}
 
-            Sfx_id hit_sfx = Sfx_id::END;
+void mk_melee_snd(const Melee_att_data& att_data, const Wpn& wpn)
+{
+    const auto& melee_data = wpn.data().melee;
 
-            switch (hit_size)
-            {
-            case Melee_hit_size::small:
-                hit_sfx = wpn.data().melee.hit_small_sfx;
-                break;
+    auto snd_alerts_mon = Alerts_mon::no;
 
-            case Melee_hit_size::medium:
-                hit_sfx = wpn.data().melee.hit_medium_sfx;
-                break;
+    if ((int(wpn.data().weight) > int(Item_weight::light)) && !att_data.is_intrinsic_att)
+    {
+        snd_alerts_mon = Alerts_mon::yes;
+    }
 
-            case Melee_hit_size::hard:
-                hit_sfx = wpn.data().melee.hit_hard_sfx;
-                break;
-            }
+    Sfx_id sfx = melee_data.miss_sfx;
 
-            Snd snd(snd_msg, hit_sfx, Ignore_msg_if_origin_seen::yes, att_data.defender->pos,
-                    att_data.attacker, Snd_vol::low, snd_alerts_mon);
+    if (is_melee_hit(att_data))
+    {
+        switch (melee_hit_size(att_data, wpn))
+        {
+        case Melee_hit_size::small:
+            sfx = melee_data.hit_small_sfx;
+            break;
 
-            snd_emit::emit_snd(snd);
+        case Melee_hit_size::medium:
+            sfx = melee_data.hit_medium_sfx;
+            break;
+
+        case Melee_hit_size::hard:
+            sfx = melee_data.hit_hard_sfx;
+            break;
         }
     }
+
+    //TODO: This message is not always appropriate (e.g. spear traps)
+    const std::string snd_msg = "I hear fighting.";
+
+    Snd snd(snd_msg, sfx, Ignore_msg_if_origin_seen::yes, att_data.defender->pos,
+            att_data.attacker, Snd_vol::low, snd_alerts_mon);
+
+    snd_emit::emit_snd(snd);
 }
 
 void print_ranged_initiate_msgs(const Ranged_att_data& data)
 {
-    if (!data.attacker)
+    if (!data.attacker || !msg_log::is_enabled())
     {
         //No attacker actor (e.g. a trap firing a dart)
         return;
@@ -856,7 +859,10 @@ void print_proj_at_actor_msgs(const Ranged_att_data& data, const bool IS_HIT, co
 
     const Pos& defender_pos = data.defender->pos;
 
-    if (IS_HIT && map::cells[defender_pos.x][defender_pos.y].is_seen_by_player)
+    if (
+        IS_HIT                                                      &&
+        map::cells[defender_pos.x][defender_pos.y].is_seen_by_player &&
+        msg_log::is_enabled())
     {
         //Punctuation depends on attack strength
         const auto& wpn_dmg = wpn.data().ranged.dmg;
@@ -1458,13 +1464,20 @@ void shotgun(Actor& attacker, const Wpn& wpn, const Pos& aim_pos)
 
 void melee(Actor* const attacker, const Pos& attacker_origin, Actor& defender, const Wpn& wpn)
 {
+    rnd::Stream_scope rnd_scope(rnd::Stream::combat);
+
     const Melee_att_data att_data(attacker, defender, wpn);
 
-    print_melee_msg_and_mk_snd(att_data, wpn);
+    //The messages are skipped when nobody is watching (the sound is still made, since it
+    //alerts monsters)
+    if (msg_log::is_enabled())
+    {
+        print_melee_msgs(att_data, wpn);
+    }
 
-    const bool IS_HIT = att_data.attack_result >= success_small &&
-                        !att_data.is_ethereal_defender_missed   &&
-                        !att_data.is_defender_dodging;
+    mk_melee_snd(att_data, wpn);
+
+    const bool IS_HIT = is_melee_hit(att_data);
 
     if (IS_HIT)
     {
@@ -1512,6 +1525,8 @@ void melee(Actor* const attacker, const Pos& attacker_origin, Actor& defender, c
 
 bool ranged(Actor* const attacker, const Pos& origin, const Pos& aim_pos, Wpn& wpn)
 {
+    rnd::Stream_scope rnd_scope(rnd::Stream::combat);
+
     bool did_attack = false;
 
     const bool HAS_INF_AMMO = wpn.data().ranged.has_infinite_ammo;
@@ -1,6 +1,8 @@
 #include "audio.hpp"
 
 #include <time.h>
+#include <algorithm>
+#include <cstdio>
 
 #include <SDL_mixer.h>
 
@@ -22,25 +24,144 @@ vector<Mix_Chunk*> audio_chunks;
 int cur_channel_     = 0;
 int time_at_last_amb_  = -1;
 
+struct Audio_file
+{
+    Audio_file(const Sfx_id sfx_, const string& filename_) :
+        sfx         (sfx_),
+        filename    (filename_) {}
+
+    Sfx_id  sfx;
+    string  filename;
+};
+
+//The files are decoded by a few worker threads, each taking the next file from this list
+vector<Audio_file>  load_list_;
+SDL_atomic_t        next_load_idx_;
+SDL_atomic_t        nr_loaded_;
+
+const int MAX_NR_LOAD_THREADS = 4;
+
 void load_audio_file(const Sfx_id sfx, const string& filename)
 {
-    render::clear_screen();
+    load_list_.push_back(Audio_file(sfx, filename));
+}
+
+int load_worker(void* data)
+{
+    (void)data;
+
+    const int NR_FILES = load_list_.size();
+
+    while (true)
+    {
+        const int IDX = SDL_AtomicAdd(&next_load_idx_, 1);
+
+        if (IDX >= NR_FILES)
+        {
+            break;
+        }
 
-    const string file_rel_path  = "audio/" + filename;
+        const Audio_file&   file            = load_list_[IDX];
+        const string        file_rel_path   = "audio/" + file.filename;
 
-    render::draw_text("Loading " + file_rel_path + "...", Panel::screen, Pos(0, 0),
-                      clr_white);
+        //Each worker writes to different elements, and the chunk vector is not resized
+        //until all workers are finished
+        audio_chunks[int(file.sfx)] = Mix_LoadWAV(file_rel_path.c_str());
+
+        if (!audio_chunks[int(file.sfx)])
+        {
+            TRACE << "Problem loading audio file with name: "   << file.filename    << endl
+                  << "Mix_GetError(): "                         << Mix_GetError()   << endl;
+        }
+
+        SDL_AtomicAdd(&nr_loaded_, 1);
+    }
+
+    return 0;
+}
+
+void draw_load_progress(const int NR_LOADED, const int NR_FILES)
+{
+    render::clear_screen();
+
+    render::draw_text("Loading audio... " + to_str((NR_LOADED * 100) / NR_FILES) + "%",
+                      Panel::screen, Pos(0, 0), clr_white);
 
     render::update_screen();
+}
+
+//Decodes all files added by load_audio_file(), while drawing a progress line
+void load_listed_files()
+{
+    const Uint32    TIME_START  = SDL_GetTicks();
+    const int       NR_FILES    = load_list_.size();
+
+    SDL_AtomicSet(&next_load_idx_,  0);
+    SDL_AtomicSet(&nr_loaded_,      0);
 
-    audio_chunks[int(sfx)] = Mix_LoadWAV(file_rel_path.c_str());
+    //Load the Ogg Vorbis library here - Mix_Init() is not safe to call from several threads
+    //at once, and would otherwise be called by the first Mix_LoadWAV() in each worker
+    Mix_Init(MIX_INIT_OGG);
 
-    if (!audio_chunks[int(sfx)])
+    const int NR_THREADS = max(1, min(MAX_NR_LOAD_THREADS, SDL_GetCPUCount()));
+
+    vector<SDL_Thread*> threads;
+
+    for (int i = 0; i < NR_THREADS; ++i)
+    {
+        SDL_Thread* const thread = SDL_CreateThread(load_worker, "audio_load", nullptr);
+
+        if (thread)
+        {
+            threads.push_back(thread);
+        }
+    }
+
+    if (threads.empty())
+    {
+        //Could not start any threads, load everything on this thread instead
+        draw_load_progress(0, NR_FILES);
+
+        load_worker(nullptr);
+    }
+    else //Worker threads are running, this thread only reports progress
+    {
+        int nr_loaded = SDL_AtomicGet(&nr_loaded_);
+
+        while (nr_loaded < NR_FILES)
+        {
+            draw_load_progress(nr_loaded, NR_FILES);
+
+            SDL_Delay(10);
+
+            nr_loaded = SDL_AtomicGet(&nr_loaded_);
+        }
+
+        for (SDL_Thread* const thread : threads)
+        {
+            SDL_WaitThread(thread, nullptr);
+        }
+    }
+
+    //The failures are reported by the workers (where the error message can be read)
+    int nr_failed = 0;
+
+    for (const Audio_file& file : load_list_)
     {
-        TRACE << "Problem loading audio file with name: "   << filename         << endl
-              << "Mix_GetError(): "                         << Mix_GetError()   << endl;
-        assert(false);
+        if (!audio_chunks[int(file.sfx)])
+        {
+            ++nr_failed;
+        }
     }
+
+    assert(nr_failed == 0);
+
+    //Reported in all builds, to see what the startup time is spent on
+    printf("Loaded %d audio files (%d failed) in %u ms, using %d thread(s)\n",
+           NR_FILES - nr_failed, nr_failed, unsigned(SDL_GetTicks() - TIME_START),
+           int(max(size_t(1), threads.size())));
+
+    load_list_.clear();
 }
 
 int next_channel(const int FROM)
@@ -157,6 +278,8 @@ void init()
 
         load_audio_file(Sfx_id::mus_cthulhiana_Madness,
                         "musica_cthulhiana-fragment-madness.ogg");
+
+        load_listed_files();
     }
     TRACE_FUNC_END;
 }
@@ -246,6 +369,8 @@ void play(const Sfx_id sfx, const Dir dir, const int DISTANCE_PERCENT)
 
 void try_play_amb(const int ONE_IN_N_CHANCE_TO_PLAY)
 {
+    rnd::Stream_scope rnd_scope(rnd::Stream::cosmetic);
+
     if (!audio_chunks.empty() && rnd::one_in(ONE_IN_N_CHANCE_TO_PLAY))
     {
         const int TIME_NOW                  = time(nullptr);
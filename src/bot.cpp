@@ -30,7 +30,7 @@ namespace bot
 namespace
 {
 
-std::vector<Pos> cur_path_;
+thread_local std::vector<Pos> cur_path_;
 
 void find_path_to_stairs()
 {
@@ -36,94 +36,225 @@ const int X_TURN    = X_ENC     + 9;
 
 const int X_THROWN  = X_WIELDED;
 
-void draw()
+namespace
 {
-    render::cover_panel(Panel::char_lines);
 
-    Player& player = *map::player;
+//An item shown on the character lines (an empty name means that there is no item)
+struct Item_snapshot
+{
+    Item_snapshot() :
+        name    (""),
+        clr     (clr_white),
+        tile    (Tile_id::empty),
+        glyph   (0) {}
+
+    string      name;
+    Clr         clr;
+    Tile_id     tile;
+    char        glyph;
+};
+
+//The content of the character lines. This is compared with the content last drawn, so that
+//the panel is only drawn again when something has changed.
+struct Snapshot
+{
+    Snapshot() :
+        name            (""),
+        hp              (0),
+        hp_max          (0),
+        spi             (0),
+        spi_max         (0),
+        shock           (0),
+        ins             (0),
+        wielded         (),
+        clvl            (0),
+        xp_to_next_lvl  (-1),
+        dlvl            (0),
+        turn            (0),
+        enc             (0),
+        thrown          (),
+        props_line      () {}
+
+    string              name;
+    int                 hp, hp_max, spi, spi_max, shock, ins;
+    Item_snapshot       wielded;
+    int                 clvl, xp_to_next_lvl, dlvl, turn, enc;
+    Item_snapshot       thrown;
+    vector<Str_and_clr> props_line;
+};
+
+thread_local Snapshot drawn_;
+
+bool is_eq(const Item_snapshot& s1, const Item_snapshot& s2)
+{
+    return s1.name  == s2.name                  &&
+           utils::is_clr_eq(s1.clr, s2.clr)     &&
+           s1.tile  == s2.tile                  &&
+           s1.glyph == s2.glyph;
+}
+
+bool is_eq(const Snapshot& s1, const Snapshot& s2)
+{
+    if (s1.hp                != s2.hp               ||
+        s1.hp_max            != s2.hp_max           ||
+        s1.spi               != s2.spi              ||
+        s1.spi_max           != s2.spi_max          ||
+        s1.shock             != s2.shock            ||
+        s1.ins               != s2.ins              ||
+        s1.clvl              != s2.clvl             ||
+        s1.xp_to_next_lvl    != s2.xp_to_next_lvl   ||
+        s1.dlvl              != s2.dlvl             ||
+        s1.turn              != s2.turn             ||
+        s1.enc               != s2.enc              ||
+        s1.name              != s2.name             ||
+        s1.props_line.size() != s2.props_line.size())
+    {
+        return false;
+    }
+
+    if (!is_eq(s1.wielded, s2.wielded) || !is_eq(s1.thrown, s2.thrown))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < s1.props_line.size(); ++i)
+    {
+        const Str_and_clr& prop1 = s1.props_line[i];
+        const Str_and_clr& prop2 = s2.props_line[i];
+
+        if (prop1.str != prop2.str || !utils::is_clr_eq(prop1.clr, prop2.clr))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void mk_item_snapshot(const Item& item, string name, Item_snapshot& out)
+{
+    text_format::first_to_upper(name);
+
+    out.name    = name;
+    out.clr     = item.clr();
+    out.tile    = item.tile();
+    out.glyph   = item.glyph();
+}
+
+void mk_snapshot(Snapshot& out)
+{
+    const Player& player = *map::player;
+
+    out.name    = player.name_a();
+    out.hp      = player.hp();
+    out.hp_max  = player.hp_max(true);
+    out.spi     = player.spi();
+    out.spi_max = player.spi_max();
+    out.shock   = player.shock_tot();
+    out.ins     = player.ins();
+
+    const Item* const item_wielded = player.inv().item_in_slot(Slot_id::wielded);
+
+    if (item_wielded)
+    {
+        const auto& data = item_wielded->data();
+
+        //If thrown weapon, force melee info - otherwise use weapon context.
+        const Item_ref_att_inf att_inf = data.main_att_mode == Main_att_mode::thrown ?
+                                         Item_ref_att_inf::melee : Item_ref_att_inf::wpn_context;
+
+        mk_item_snapshot(*item_wielded,
+                         item_wielded->name(Item_ref_type::plain, Item_ref_inf::yes, att_inf),
+                         out.wielded);
+    }
+
+    out.clvl            = dungeon_master::clvl();
+    out.xp_to_next_lvl  = out.clvl < PLAYER_MAX_CLVL ? dungeon_master::xp_to_next_lvl() : -1;
+    out.dlvl            = map::dlvl;
+    out.turn            = game_time::turn();
+    out.enc             = player.enc_percent();
+
+    const Item* const item_missiles = player.inv().item_in_slot(Slot_id::thrown);
+
+    if (item_missiles)
+    {
+        mk_item_snapshot(*item_missiles,
+                         item_missiles->name(Item_ref_type::plural, Item_ref_inf::yes,
+                                             Item_ref_att_inf::thrown),
+                         out.thrown);
+    }
+
+    player.prop_handler().props_interface_line(out.props_line);
+}
+
+void draw_item(const Item_snapshot& item, Pos pos)
+{
+    if (config::is_tiles_mode())
+    {
+        render::draw_tile(item.tile, Panel::char_lines, pos, item.clr);
+    }
+    else //Text mode
+    {
+        render::draw_glyph(item.glyph, Panel::char_lines, pos, item.clr);
+    }
+
+    pos.x += 2;
+
+    render::draw_text(item.name, Panel::char_lines, pos, clr_white);
+}
+
+void draw_snapshot(const Snapshot& s)
+{
+    render::cover_panel(Panel::char_lines);
 
     Pos pos(0, 0);
 
     //Name
     pos.x = X_NAME;
-    string str = player.name_a();
+    string str = s.name;
     render::draw_text(str, Panel::char_lines, pos, clr_white);
 
     //Health
     pos.x = X_HP;
-    const string hp     = to_str(player.hp());
-    const string hp_max = to_str(player.hp_max(true));
     str = "H:";
     render::draw_text(str, Panel::char_lines, pos, clr_menu_drk);
     pos.x += str.length();
-    str = hp + "/" + hp_max;
+    str = to_str(s.hp) + "/" + to_str(s.hp_max);
     render::draw_text(str, Panel::char_lines, pos, clr_red_lgt);
 
     //Spirit
     pos.x = X_SPI;
-    const string spi        = to_str(player.spi());
-    const string spi_max    = to_str(player.spi_max());
     str = "S:";
     render::draw_text(str, Panel::char_lines, pos, clr_menu_drk);
     pos.x += str.length();
-    str = spi + "/" + spi_max;
+    str = to_str(s.spi) + "/" + to_str(s.spi_max);
     render::draw_text(str, Panel::char_lines, pos, clr_blue_lgt);
 
     //Insanity
     pos.x = X_INS;
-    const int SHOCK = player.shock_tot();
-    const int INS = player.ins();
     str = "INS:";
     render::draw_text(str, Panel::char_lines, pos, clr_menu_drk);
     pos.x += str.length();
     const Clr short_san_clr =
-        SHOCK < 50  ? clr_green_lgt :
-        SHOCK < 75  ? clr_yellow   :
-        SHOCK < 100 ? clr_magenta  : clr_red_lgt;
-    str = to_str(SHOCK) + "%/";
+        s.shock < 50  ? clr_green_lgt :
+        s.shock < 75  ? clr_yellow   :
+        s.shock < 100 ? clr_magenta  : clr_red_lgt;
+    str = to_str(s.shock) + "%/";
     render::draw_text(str, Panel::char_lines, pos, short_san_clr);
     pos.x += str.length();
-    str = to_str(INS) + "%";
+    str = to_str(s.ins) + "%";
     render::draw_text(str, Panel::char_lines, pos, clr_magenta);
 
     //Wielded weapon
     pos.x = X_WIELDED;
 
-    Item* item_wielded = map::player->inv().item_in_slot(Slot_id::wielded);
-
-    if (item_wielded)
+    if (s.wielded.name.empty())
     {
-        const Clr item_clr = item_wielded->clr();
-
-        if (config::is_tiles_mode())
-        {
-            render::draw_tile(item_wielded->tile(), Panel::char_lines, pos, item_clr);
-        }
-        else //Text mode
-        {
-            render::draw_glyph(item_wielded->glyph(), Panel::char_lines, pos, item_clr);
-        }
-
-        pos.x += 2;
-
-        const auto& data = item_wielded->data();
-
-        //If thrown weapon, force melee info - otherwise use weapon context.
-        const Item_ref_att_inf att_inf = data.main_att_mode == Main_att_mode::thrown ?
-                                         Item_ref_att_inf::melee : Item_ref_att_inf::wpn_context;
-
-        str = item_wielded->name(Item_ref_type::plain, Item_ref_inf::yes, att_inf);
-
-        text_format::first_to_upper(str);
-
-        render::draw_text(str, Panel::char_lines, pos, clr_white);
-        pos.x += str.length() + 1;
+        render::draw_text("Unarmed", Panel::char_lines, pos, clr_gray);
     }
     else
     {
-        str = "Unarmed";
-        render::draw_text(str, Panel::char_lines, pos, clr_gray);
-        pos.x += str.length() + 1;
+        draw_item(s.wielded, pos);
     }
 
     //----------------------------------------------------------------------------- SECOND ROW
@@ -134,11 +265,11 @@ void draw()
     str = "LVL:";
     render::draw_text(str, Panel::char_lines, pos, clr_menu_drk);
     pos.x += str.length();
-    str = to_str(dungeon_master::clvl());
-    if (dungeon_master::clvl() < PLAYER_MAX_CLVL)
+    str = to_str(s.clvl);
+    if (s.xp_to_next_lvl >= 0)
     {
         //Not at maximum character level
-        str += "(" + to_str(dungeon_master::xp_to_next_lvl()) + ")";
+        str += "(" + to_str(s.xp_to_next_lvl) + ")";
     }
     render::draw_text(str, Panel::char_lines, pos, clr_white);
 
@@ -147,7 +278,7 @@ void draw()
     str = "DLVL:";
     render::draw_text(str, Panel::char_lines, pos, clr_menu_drk);
     pos.x += str.length();
-    str = map::dlvl > 0 ? to_str(map::dlvl) : "-";
+    str = s.dlvl > 0 ? to_str(s.dlvl) : "-";
     render::draw_text(str, Panel::char_lines, pos, clr_white);
 
     //Turn number
@@ -155,7 +286,7 @@ void draw()
     str = "T:";
     render::draw_text(str, Panel::char_lines, pos, clr_menu_drk);
     pos.x += str.length();
-    str = to_str(game_time::turn());
+    str = to_str(s.turn);
     render::draw_text(str, Panel::char_lines, pos, clr_white);
 
     //Encumbrance
@@ -163,59 +294,55 @@ void draw()
     str = "ENC:";
     render::draw_text(str, Panel::char_lines, pos, clr_menu_drk);
     pos.x += str.length();
-    const int ENC = map::player->enc_percent();
-    str = to_str(ENC) + "%";
-    const Clr enc_clr = ENC < 100 ? clr_green_lgt :
-                        ENC < ENC_IMMOBILE_LVL ? clr_yellow : clr_red_lgt;
+    str = to_str(s.enc) + "%";
+    const Clr enc_clr = s.enc < 100 ? clr_green_lgt :
+                        s.enc < ENC_IMMOBILE_LVL ? clr_yellow : clr_red_lgt;
     render::draw_text(str, Panel::char_lines, pos, enc_clr);
 
     //Thrown weapon
     pos.x = X_THROWN;
 
-    auto* const item_missiles = map::player->inv().item_in_slot(Slot_id::thrown);
-
-    if (item_missiles)
+    if (s.thrown.name.empty())
     {
-        const Clr item_clr = item_missiles->clr();
-
-        if (config::is_tiles_mode())
-        {
-            render::draw_tile(item_missiles->tile(), Panel::char_lines, pos, item_clr);
-        }
-        else
-        {
-            render::draw_glyph(item_missiles->glyph(), Panel::char_lines, pos, item_clr);
-        }
-
-        pos.x += 2;
-
-        str = item_missiles->name(Item_ref_type::plural, Item_ref_inf::yes,
-                                  Item_ref_att_inf::thrown);
-
-        text_format::first_to_upper(str);
-
-        render::draw_text(str, Panel::char_lines, pos, clr_white);
-        pos.x += str.length() + 1;
+        render::draw_text("No thrown weapon", Panel::char_lines, pos, clr_gray);
     }
     else
     {
-        render::draw_text("No thrown weapon", Panel::char_lines, pos, clr_gray);
+        draw_item(s.thrown, pos);
     }
 
     //----------------------------------------------------------------------------- THIRD ROW
     ++pos.y;
     pos.x = 0;
 
-    vector<Str_and_clr> props_line;
-    map::player->prop_handler().props_interface_line(props_line);
-    const int NR_PROPS = props_line.size();
-
-    for (int i = 0; i < NR_PROPS; ++i)
+    for (const Str_and_clr& cur_prop_label : s.props_line)
     {
-        const Str_and_clr& cur_prop_label = props_line[i];
         render::draw_text(cur_prop_label.str, Panel::char_lines, pos, cur_prop_label.clr);
         pos.x += cur_prop_label.str.length() + 1;
     }
 }
 
+} //namespace
+
+void draw()
+{
+    Snapshot snapshot;
+
+    mk_snapshot(snapshot);
+
+    //Nothing to do if the panel on the screen already shows this
+    if (render::is_panel_retained(Panel::char_lines) && is_eq(snapshot, drawn_))
+    {
+        return;
+    }
+
+    render::begin_retained_panel(Panel::char_lines);
+
+    draw_snapshot(snapshot);
+
+    render::end_retained_panel();
+
+    drawn_ = snapshot;
+}
+
 } //Character_lines
@@ -12,6 +12,7 @@
 #include "player_bon.hpp"
 #include "feature_rigid.hpp"
 #include "feature_mob.hpp"
+#include "fire_smoke.hpp"
 
 using namespace std;
 
@@ -79,8 +80,6 @@ void cells_reached(const Rect& area, const Pos& origin,
                    bool blocked[MAP_W][MAP_H],
                    vector< vector<Pos> >& pos_list_ref)
 {
-    vector<Pos> line;
-
     for (int y = area.p0.y; y <= area.p1.y; ++y)
     {
         for (int x = area.p0.x; x <= area.p1.x; ++x)
@@ -91,9 +90,11 @@ void cells_reached(const Rect& area, const Pos& origin,
 
             if (DIST > 1)
             {
-                line_calc::calc_new_line(origin, pos, true, 999, false, line);
+                line_calc::Line_iter line(origin, pos, true, 999, false);
+
+                Pos pos_check_block;
 
-                for (Pos& pos_check_block : line)
+                while (line.next(pos_check_block))
                 {
                     if (blocked[pos_check_block.x][pos_check_block.y])
                     {
@@ -214,7 +215,7 @@ void run_explosion_at(const Pos&            origin,
                 for (Actor* corpse : corpses_here) {corpse->hit(DMG, Dmg_type::physical);}
 
                 //Add smoke
-                if (rnd::fraction(6, 10)) {game_time::add_mob(new Smoke(pos, rnd::range(2, 4)));}
+                if (rnd::fraction(6, 10)) {fire_smoke::put_smoke(pos, rnd::range(2, 4));}
             }
 
             //Apply property
@@ -288,7 +289,7 @@ void run_smoke_explosion_at(const Pos& origin/*, const int SMOKE_DURATION*/)
         {
             if (!blocked[pos.x][pos.y])
             {
-                game_time::add_mob(new Smoke(pos, rnd::range(25, 30)));
+                fire_smoke::put_smoke(pos, rnd::range(25, 30));
             }
         }
     }
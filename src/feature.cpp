@@ -120,6 +120,18 @@ bool Feature::can_have_item() const
     return data().can_have_item;
 }
 
+unsigned char Feature::traits() const
+{
+    unsigned char traits = 0;
+
+    if (can_move_cmn())             {traits |= feature_trait::can_move_cmn;}
+    if (is_los_passable())          {traits |= feature_trait::is_los_passable;}
+    if (is_projectile_passable())   {traits |= feature_trait::is_projectile_passable;}
+    if (can_have_item())            {traits |= feature_trait::can_have_item;}
+
+    return traits;
+}
+
 Feature_id Feature::id() const
 {
     return data().id;
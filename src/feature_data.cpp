@@ -92,6 +92,7 @@ bool Move_rules::can_move(Actor& actor) const
 namespace feature_data
 {
 
+//Never changed after it is built, so it is shared by all sessions (and threads)
 Feature_data_t data_list[int(Feature_id::END)];
 
 namespace
@@ -150,7 +151,7 @@ void init_data_list()
     //---------------------------------------------------------------------------
     d.id = Feature_id::wall;
     d.mk_obj = [](const Pos & p) {return new Wall(p);};
-    d.glyph = config::is_text_mode_wall_full_square() ? 10 : '#';
+    d.glyph = '#'; //NOTE: Wall::glyph() uses a full square instead, if set in the options
     d.tile = Tile_id::wall_top;
     d.move_rules.set_prop_can_move(Prop_id::ethereal);
     d.move_rules.set_prop_can_move(Prop_id::burrowing);
@@ -574,7 +575,6 @@ void init_data_list()
     add_to_list_and_reset(d);
     //---------------------------------------------------------------------------
     d.id = Feature_id::smoke;
-    d.mk_obj = [](const Pos & p) {return new Smoke(p);};
     d.glyph = '*';
     d.tile = Tile_id::smoke;
     d.move_rules.set_can_move_cmn();
@@ -598,13 +598,17 @@ void init_data_list()
 void init()
 {
     TRACE_FUNC_BEGIN;
-    init_data_list();
+
+    //Only built once per process
+    static const bool IS_DATA_BUILT = (init_data_list(), true);
+
+    (void)IS_DATA_BUILT;
+
     TRACE_FUNC_END;
 }
 
 const Feature_data_t& data(const Feature_id id)
 {
-    assert(id != Feature_id::END);
     assert(id != Feature_id::END);
     return data_list[int(id)];
 }
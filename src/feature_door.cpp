@@ -725,6 +725,8 @@ void Door::try_close(Actor* actor_trying)
         {
             is_open_ = false;
 
+            map::update_cell_traits(pos_);
+
             if (IS_PLAYER)
             {
                 Snd snd("", Sfx_id::door_close, Ignore_msg_if_origin_seen::yes, pos_,
@@ -751,6 +753,8 @@ void Door::try_close(Actor* actor_trying)
             {
                 is_open_ = false;
 
+                map::update_cell_traits(pos_);
+
                 if (IS_PLAYER)
                 {
                     Snd snd("", Sfx_id::door_close, Ignore_msg_if_origin_seen::yes, pos_,
@@ -840,6 +844,8 @@ void Door::try_open(Actor* actor_trying)
             TRACE << "Tryer can see, opening" << endl;
             is_open_ = true;
 
+            map::update_cell_traits(pos_);
+
             if (IS_PLAYER)
             {
                 Snd snd("", Sfx_id::door_open, Ignore_msg_if_origin_seen::yes, pos_,
@@ -871,6 +877,8 @@ void Door::try_open(Actor* actor_trying)
                 TRACE << "Tryer is blind, but open succeeded anyway" << endl;
                 is_open_ = true;
 
+                map::update_cell_traits(pos_);
+
                 if (IS_PLAYER)
                 {
                     Snd snd("", Sfx_id::door_open, Ignore_msg_if_origin_seen::yes, pos_,
@@ -950,5 +958,8 @@ Did_open Door::open(Actor* const actor_opening)
     is_open_   = true;
     is_secret_ = false;
     is_stuck_  = false;
+
+    map::update_cell_traits(pos_);
+
     return Did_open::yes;
 }
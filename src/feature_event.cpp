@@ -128,7 +128,7 @@ void Event_wall_crumble::on_new_turn()
 
             int nr_mon_spawned = 0;
 
-            random_shuffle(begin(inner_cells_), end(inner_cells_));
+            rnd::shuffle(inner_cells_);
 
             for (const Pos& p : inner_cells_)
             {
@@ -13,6 +13,7 @@
 #include "item_factory.hpp"
 #include "map_parsing.hpp"
 #include "feature_mob.hpp"
+#include "fire_smoke.hpp"
 #include "drop.hpp"
 #include "explosion.hpp"
 #include "actor_factory.hpp"
@@ -32,126 +33,136 @@ Rigid::Rigid(const Pos& feature_pos) :
 
 void Rigid::on_new_turn()
 {
-    if (burn_state_ == Burn_state::burning)
-    {
-        clear_gore();
+    //Run specialized new turn actions
+    on_new_turn_hook();
+}
 
-        auto scorch_actor = [](Actor & actor)
+void Rigid::on_burning_turn(Actor* const living_actors[MAP_W][MAP_H])
+{
+    assert(burn_state_ == Burn_state::burning);
+
+    clear_gore();
+
+    auto scorch_actor = [](Actor & actor)
+    {
+        if (&actor == map::player)
         {
-            if (&actor == map::player)
-            {
-                msg_log::add("I am scorched by flames.", clr_msg_bad);
-            }
-            else
+            msg_log::add("I am scorched by flames.", clr_msg_bad);
+        }
+        else
+        {
+            if (map::player->can_see_actor(actor))
             {
-                if (map::player->can_see_actor(actor))
-                {
-                    msg_log::add(actor.name_the() + " is scorched by flames.", clr_msg_good);
-                }
+                msg_log::add(actor.name_the() + " is scorched by flames.", clr_msg_good);
             }
+        }
 
-            actor.hit(1, Dmg_type::fire);
-        };
+        actor.hit(1, Dmg_type::fire);
+    };
+
+    //The actors may have been killed earlier this turn
+    auto living_actor_at = [living_actors](const Pos & p) -> Actor*
+    {
+        Actor* const actor = living_actors[p.x][p.y];
+
+        return (actor && actor->is_alive()) ? actor : nullptr;
+    };
 
-        //TODO: Hit dead actors
+    //TODO: Hit dead actors
 
-        //Hit actor standing on feature
-        auto* actor = utils::actor_at_pos(pos_);
+    //Hit actor standing on feature
+    auto* actor = living_actor_at(pos_);
 
-        if (actor)
+    if (actor)
+    {
+        //Occasionally try to set actor on fire, otherwise just do small fire damage
+        if (rnd::one_in(4))
         {
-            //Occasionally try to set actor on fire, otherwise just do small fire damage
-            if (rnd::one_in(4))
-            {
-                auto& prop_handler = actor->prop_handler();
-                prop_handler.try_add_prop(new Prop_burning(Prop_turns::std));
-            }
-            else
-            {
-                scorch_actor(*actor);
-            }
+            auto& prop_handler = actor->prop_handler();
+            prop_handler.try_add_prop(new Prop_burning(Prop_turns::std));
+        }
+        else
+        {
+            scorch_actor(*actor);
         }
+    }
 
-        //Finished burning?
-        int finish_burning_one_in_n = 1;
-        int hit_adjacent_one_in_n   = 1;
+    //Finished burning?
+    int finish_burning_one_in_n = 1;
+    int hit_adjacent_one_in_n   = 1;
 
-        switch (matl())
-        {
-        case Matl::fluid:
-        case Matl::empty:
-            finish_burning_one_in_n = 1;
-            hit_adjacent_one_in_n   = 1;
-            break;
+    switch (matl())
+    {
+    case Matl::fluid:
+    case Matl::empty:
+        finish_burning_one_in_n = 1;
+        hit_adjacent_one_in_n   = 1;
+        break;
 
-        case Matl::stone:
-            finish_burning_one_in_n = 12;
-            hit_adjacent_one_in_n   = 12;
-            break;
+    case Matl::stone:
+        finish_burning_one_in_n = 12;
+        hit_adjacent_one_in_n   = 12;
+        break;
 
-        case Matl::metal:
-            finish_burning_one_in_n = 12;
-            hit_adjacent_one_in_n   = 8;
-            break;
+    case Matl::metal:
+        finish_burning_one_in_n = 12;
+        hit_adjacent_one_in_n   = 8;
+        break;
 
-        case Matl::plant:
-            finish_burning_one_in_n = 30;
-            hit_adjacent_one_in_n   = 12;
-            break;
+    case Matl::plant:
+        finish_burning_one_in_n = 30;
+        hit_adjacent_one_in_n   = 12;
+        break;
 
-        case Matl::wood:
-            finish_burning_one_in_n = 60;
-            hit_adjacent_one_in_n   = 16;
-            break;
+    case Matl::wood:
+        finish_burning_one_in_n = 60;
+        hit_adjacent_one_in_n   = 16;
+        break;
 
-        case Matl::cloth:
-            finish_burning_one_in_n = 20;
-            hit_adjacent_one_in_n   = 8;
-            break;
-        }
+    case Matl::cloth:
+        finish_burning_one_in_n = 20;
+        hit_adjacent_one_in_n   = 8;
+        break;
+    }
 
-        if (rnd::one_in(finish_burning_one_in_n))
-        {
-            burn_state_ = Burn_state::has_burned;
+    if (rnd::one_in(finish_burning_one_in_n))
+    {
+        burn_state_ = Burn_state::has_burned;
 
-            if (on_finished_burning() == Was_destroyed::yes)
-            {
-                return;
-            }
+        if (on_finished_burning() == Was_destroyed::yes)
+        {
+            return;
         }
+    }
 
-        //Hit adjacent features and actors?
-        if (rnd::one_in(hit_adjacent_one_in_n))
-        {
-            const Pos p(dir_utils::rnd_adj_pos(pos_, false));
+    //Hit adjacent features and actors?
+    if (rnd::one_in(hit_adjacent_one_in_n))
+    {
+        const Pos p(dir_utils::rnd_adj_pos(pos_, false));
 
-            if (utils::is_pos_inside_map(p))
-            {
-                map::cells[p.x][p.y].rigid->hit(Dmg_type::fire, Dmg_method::elemental);
+        if (utils::is_pos_inside_map(p))
+        {
+            map::cells[p.x][p.y].rigid->hit(Dmg_type::fire, Dmg_method::elemental);
 
-                actor = utils::actor_at_pos(p);
+            actor = living_actor_at(p);
 
-                if (actor) {scorch_actor(*actor);}
-            }
+            if (actor) {scorch_actor(*actor);}
         }
+    }
 
-        //Create smoke?
-        if (rnd::one_in(20))
-        {
-            const Pos p(dir_utils::rnd_adj_pos(pos_, true));
+    //Create smoke?
+    if (rnd::one_in(20))
+    {
+        const Pos p(dir_utils::rnd_adj_pos(pos_, true));
 
-            if (utils::is_pos_inside_map(p))
+        if (utils::is_pos_inside_map(p))
+        {
+            if (!cell_check::Blocks_move_cmn(false).check(map::cells[p.x][p.y]))
             {
-                if (!cell_check::Blocks_move_cmn(false).check(map::cells[p.x][p.y]))
-                {
-                    game_time::add_mob(new Smoke(p, 10));
-                }
+                fire_smoke::put_smoke(p, 10);
             }
         }
     }
-
-    //Run specialized new turn actions
-    on_new_turn_hook();
 }
 
 void Rigid::try_start_burning(const bool IS_MSG_ALLOWED)
@@ -168,6 +179,8 @@ void Rigid::try_start_burning(const bool IS_MSG_ALLOWED)
         }
 
         burn_state_ = Burn_state::burning;
+
+        fire_smoke::on_start_burning(pos_);
     }
 }
 
@@ -1493,6 +1506,8 @@ Item_container::~Item_container()
 
 void Item_container::init(const Feature_id feature_id, const int NR_ITEMS_TO_ATTEMPT)
 {
+    rnd::Stream_scope rnd_scope(rnd::Stream::loot);
+
     for (auto* item : items_) {delete item;}
 
     items_.clear();
@@ -2597,7 +2612,7 @@ Fountain::Fountain(const Pos& feature_pos) :
             Fountain_effect::rConf
         };
 
-        std::random_shuffle(begin(effect_bucket), end(effect_bucket));
+        rnd::shuffle(effect_bucket);
 
         const int NR_EFFECTS = 3;
 
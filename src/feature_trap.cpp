@@ -560,7 +560,7 @@ Trap_placement_valid Trap_dart::on_place()
 {
     auto offsets = dir_utils::cardinal_list;
 
-    random_shuffle(begin(offsets), end(offsets));
+    rnd::shuffle(offsets);
 
     const int NR_STEPS_MIN = 2;
     const int NR_STEPS_MAX = FOV_STD_RADI_INT;
@@ -680,7 +680,7 @@ Trap_placement_valid Trap_spear::on_place()
 {
     auto offsets = dir_utils::cardinal_list;
 
-    random_shuffle(begin(offsets), end(offsets));
+    rnd::shuffle(offsets);
 
     auto trap_plament_valid = Trap_placement_valid::no;
 
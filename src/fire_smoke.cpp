@@ -0,0 +1,301 @@
+#include "fire_smoke.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include "init.hpp"
+#include "actor_player.hpp"
+#include "feature_rigid.hpp"
+#include "game_time.hpp"
+#include "inventory.hpp"
+#include "item.hpp"
+#include "map.hpp"
+#include "msg_log.hpp"
+#include "properties.hpp"
+#include "sound.hpp"
+#include "utils.hpp"
+
+namespace fire_smoke
+{
+
+namespace
+{
+
+const Rect EMPTY_AREA(MAP_W, MAP_H, -1, -1);
+
+//Number of turns left of the smoke on each cell (0 = no smoke)
+thread_local Uint8  smoke_[MAP_W][MAP_H];
+
+//Snapshot of the burning cells at the start of the turn
+thread_local bool   burning_[MAP_W][MAP_H];
+
+//Bounding rectangles of the cells which may be burning, and which may have smoke. They
+//only ever grow during a turn, and are shrunk to fit when the cells are visited.
+thread_local Rect   fire_area_  = EMPTY_AREA;
+thread_local Rect   smoke_area_ = EMPTY_AREA;
+
+//The smoke area being visited by run_smoke() (the cells not visited yet are not in the
+//smoke area during the visit)
+thread_local Rect   smoke_area_visiting_ = EMPTY_AREA;
+
+bool is_empty(const Rect& area)
+{
+    return area.p0.x > area.p1.x;
+}
+
+void grow(Rect& area, const Pos& p)
+{
+    area.p0.x = std::min(area.p0.x, p.x);
+    area.p0.y = std::min(area.p0.y, p.y);
+    area.p1.x = std::max(area.p1.x, p.x);
+    area.p1.y = std::max(area.p1.y, p.y);
+}
+
+void mk_living_actor_array(Actor* a[MAP_W][MAP_H])
+{
+    utils::reset_array(a);
+
+    for (Actor* actor : game_time::actors_)
+    {
+        if (actor->is_alive())
+        {
+            const Pos& p = actor->pos;
+            a[p.x][p.y] = actor;
+        }
+    }
+}
+
+void run_smoke_on_actor(Actor& actor)
+{
+    const bool IS_PLAYER = &actor == map::player;
+
+    //TODO: There needs to be some criteria here, so that e.g. a statue-monster or a
+    //very alien monster can't get blinded by smoke (but do not use is_humanoid - rats,
+    //wolves etc should definitely be blinded by smoke).
+
+    //Perhaps add some variable like "has_eyes"?
+
+    bool is_protected_blindness = false;
+
+    if (IS_PLAYER)
+    {
+        auto&       inv                 = map::player->inv();
+        auto* const player_head_item    = inv.slots_[int(Slot_id::head)].item;
+        auto* const player_body_item    = inv.slots_[int(Slot_id::body)].item;
+
+        if (player_head_item)
+        {
+            if (player_head_item->data().id == Item_id::gas_mask)
+            {
+                is_protected_blindness = true;
+
+                //This may destroy the gasmask
+                static_cast<Gas_mask*>(player_head_item)->decr_turns_left(inv);
+            }
+        }
+
+        if (player_body_item)
+        {
+            if (player_body_item->data().id == Item_id::armor_asb_suit)
+            {
+                is_protected_blindness = true;
+            }
+        }
+    }
+
+    //Blinded by smoke?
+    if (!is_protected_blindness && rnd::one_in(4))
+    {
+        if (IS_PLAYER)
+        {
+            msg_log::add("I am getting smoke in my eyes.");
+        }
+
+        actor.prop_handler().try_add_prop(
+            new Prop_blind(Prop_turns::specific, rnd::range(1, 3)));
+    }
+
+    //Choking (this is determined by rBreath)?
+    if (rnd::one_in(4))
+    {
+        if (!actor.has_prop(Prop_id::rBreath))
+        {
+            std::string snd_msg = "";
+
+            if (IS_PLAYER)
+            {
+                msg_log::add("I am choking!", clr_msg_bad);
+            }
+            else
+            {
+                if (actor.is_humanoid()) {snd_msg = "I hear choking.";}
+            }
+
+            const auto alerts = IS_PLAYER ? Alerts_mon::yes : Alerts_mon::no;
+
+            snd_emit::emit_snd(Snd(snd_msg, Sfx_id::END, Ignore_msg_if_origin_seen::yes,
+                                   actor.pos, &actor, Snd_vol::low, alerts));
+
+            actor.hit(1, Dmg_type::pure);
+        }
+    }
+}
+
+void run_fire(Actor* const living_actors[MAP_W][MAP_H])
+{
+    const Rect area = fire_area_;
+
+    fire_area_ = EMPTY_AREA;
+
+    //Take the snapshot first - cells set on fire below are added to the area by
+    //on_start_burning(), and are visited next turn
+    for (int x = area.p0.x; x <= area.p1.x; ++x)
+    {
+        for (int y = area.p0.y; y <= area.p1.y; ++y)
+        {
+            burning_[x][y] = map::cells[x][y].rigid->burn_state() == Burn_state::burning;
+
+            if (burning_[x][y])
+            {
+                grow(fire_area_, Pos(x, y));
+            }
+        }
+    }
+
+    for (int x = area.p0.x; x <= area.p1.x; ++x)
+    {
+        for (int y = area.p0.y; y <= area.p1.y; ++y)
+        {
+            if (burning_[x][y])
+            {
+                //The rigid may have been replaced earlier this turn (e.g. burnt down)
+                Rigid* const rigid = map::cells[x][y].rigid;
+
+                if (rigid->burn_state() == Burn_state::burning)
+                {
+                    rigid->on_burning_turn(living_actors);
+                }
+            }
+        }
+    }
+}
+
+void run_smoke(Actor* const living_actors[MAP_W][MAP_H])
+{
+    const Rect area = smoke_area_;
+
+    smoke_area_             = EMPTY_AREA;
+    smoke_area_visiting_    = area;
+
+    //Smoke does not spread, each cell only depends on itself - so it can be updated in
+    //place. Smoke put during this loop (e.g. by an actor dying in a fire) grows the area.
+    for (int x = area.p0.x; x <= area.p1.x; ++x)
+    {
+        for (int y = area.p0.y; y <= area.p1.y; ++y)
+        {
+            if (smoke_[x][y] == 0)
+            {
+                continue;
+            }
+
+            Actor* const actor = living_actors[x][y];
+
+            if (actor && actor->is_alive())
+            {
+                run_smoke_on_actor(*actor);
+            }
+
+            if (--smoke_[x][y] > 0)
+            {
+                grow(smoke_area_, Pos(x, y));
+            }
+        }
+    }
+
+    smoke_area_visiting_ = EMPTY_AREA;
+}
+
+} //namespace
+
+void reset()
+{
+    memset(smoke_, 0, sizeof(smoke_));
+
+    fire_area_              = EMPTY_AREA;
+    smoke_area_             = EMPTY_AREA;
+    smoke_area_visiting_    = EMPTY_AREA;
+}
+
+void put_smoke(const Pos& p, const int NR_TURNS)
+{
+    assert(utils::is_pos_inside_map(p));
+    assert(NR_TURNS > 0);
+
+    const Uint8 NR_TURNS_CLAMPED = Uint8(std::min(NR_TURNS, 255));
+
+    smoke_[p.x][p.y] = std::max(smoke_[p.x][p.y], NR_TURNS_CLAMPED);
+
+    grow(smoke_area_, p);
+}
+
+bool is_smoke_at(const Pos& p)
+{
+    return smoke_[p.x][p.y] > 0;
+}
+
+void mark_smoke(bool out[MAP_W][MAP_H], const Rect& area)
+{
+    Rect smoke_area = smoke_area_;
+
+    if (!is_empty(smoke_area_visiting_))
+    {
+        grow(smoke_area, smoke_area_visiting_.p0);
+        grow(smoke_area, smoke_area_visiting_.p1);
+    }
+
+    const int X0 = std::max(area.p0.x, smoke_area.p0.x);
+    const int Y0 = std::max(area.p0.y, smoke_area.p0.y);
+    const int X1 = std::min(area.p1.x, smoke_area.p1.x);
+    const int Y1 = std::min(area.p1.y, smoke_area.p1.y);
+
+    for (int x = X0; x <= X1; ++x)
+    {
+        for (int y = Y0; y <= Y1; ++y)
+        {
+            if (smoke_[x][y] > 0)
+            {
+                out[x][y] = true;
+            }
+        }
+    }
+}
+
+void on_start_burning(const Pos& p)
+{
+    grow(fire_area_, p);
+}
+
+void on_new_turn()
+{
+    if (is_empty(fire_area_) && is_empty(smoke_area_))
+    {
+        return;
+    }
+
+    Actor* living_actors[MAP_W][MAP_H];
+
+    mk_living_actor_array(living_actors);
+
+    if (!is_empty(fire_area_))
+    {
+        run_fire(living_actors);
+    }
+
+    if (!is_empty(smoke_area_))
+    {
+        run_smoke(living_actors);
+    }
+}
+
+} //fire_smoke
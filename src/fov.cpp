@@ -9,6 +9,7 @@
 #include "line_calc.hpp"
 #include "map.hpp"
 #include "utils.hpp"
+#include "profiler.hpp"
 
 namespace fov
 {
@@ -48,7 +49,7 @@ Los_result check_cell(const Pos& p0,
 
     const Pos delta(p1 - p0);
 
-    const std::vector<Pos>* path_deltas_ptr =
+    const line_calc::Delta_line* path_deltas_ptr =
         line_calc::fov_delta_line(delta, FOV_STD_RADI_DB);
 
     if (!path_deltas_ptr)
@@ -57,7 +58,7 @@ Los_result check_cell(const Pos& p0,
         return los_result;
     }
 
-    const std::vector<Pos>& path_deltas = *path_deltas_ptr;
+    const line_calc::Delta_line& path_deltas = *path_deltas_ptr;
 
     const bool TGT_IS_LGT = map::cells[p1.x][p1.y].is_lit;
 
@@ -114,6 +115,8 @@ void run(const Pos& p0,
          const bool hard_blocked[MAP_W][MAP_H],
          Los_result out[MAP_W][MAP_H])
 {
+    PROFILE_SCOPE("fov::run");
+
     for (int x = 0; x < MAP_W; ++x)
     {
         for (int y = 0; y < MAP_H; ++y)
@@ -6,6 +6,7 @@
 #include "cmn_types.hpp"
 #include "feature_rigid.hpp"
 #include "feature_mob.hpp"
+#include "fire_smoke.hpp"
 #include "actor_player.hpp"
 #include "actor_mon.hpp"
 #include "map.hpp"
@@ -19,23 +20,25 @@
 #include "render.hpp"
 #include "utils.hpp"
 #include "map_travel.hpp"
+#include "perception.hpp"
 #include "item.hpp"
+#include "profiler.hpp"
 
 using namespace std;
 
 namespace game_time
 {
 
-vector<Actor*>      actors_;
-vector<Mob*> mobs_;
+thread_local Slot_map<Actor>     actors_;
+thread_local Slot_map<Mob>       mobs_;
 
 namespace
 {
 
-vector<Actor_speed>  turn_type_vector_;
-int                 cur_turn_type_pos_   = 0;
-size_t              cur_actor_index_    = 0;
-int                 turn_nr_             = 0;
+thread_local vector<Actor_speed>  turn_type_vector_;
+thread_local int                 cur_turn_type_pos_   = 0;
+thread_local size_t              cur_actor_index_    = 0;
+thread_local int                 turn_nr_             = 0;
 
 bool is_spi_regen_this_turn(const int REGEN_N_TURNS)
 {
@@ -47,6 +50,10 @@ void run_std_turn_events()
 {
     ++turn_nr_;
 
+    PROFILE_NEW_TURN(turn_nr_);
+
+    PROFILE_SCOPE("game_time::run_std_turn_events");
+
     int regen_spi_nTurns = 12;
 
     for (size_t i = 0; i < actors_.size(); ++i)
@@ -62,14 +69,8 @@ void run_std_turn_events()
                 return;
             }
 
-            if (map::player->tgt_ == actor)
-            {
-                map::player->tgt_ = nullptr;
-            }
-
-            delete actor;
-
-            actors_.erase(actors_.begin() + i);
+            //NOTE: The last actor is moved into this element, so it is checked next
+            erase_actor_in_element(i);
             i--;
 
             if (cur_actor_index_ >= actors_.size()) {cur_actor_index_ = 0;}
@@ -132,8 +133,11 @@ void run_std_turn_events()
         }
     }
 
+    //Fire and smoke
+    fire_smoke::on_new_turn();
+
     //New turn for mobs (using a copied vector, since mobs may get destroyed)
-    const vector<Mob*> mobs_cpy = mobs_;
+    const vector<Mob*> mobs_cpy = mobs_.elements();
 
     for (auto* f : mobs_cpy) {f->on_new_turn();}
 
@@ -185,6 +189,8 @@ void init()
     cur_turn_type_pos_ = cur_actor_index_ = turn_nr_ = 0;
     actors_.clear();
     mobs_  .clear();
+
+    perception::invalidate();
 }
 
 void cleanup()
@@ -193,6 +199,8 @@ void cleanup()
 
     actors_.clear();
 
+    perception::invalidate();
+
     for (auto* f : mobs_) {delete f;}
 
     mobs_.clear();
@@ -223,21 +231,14 @@ void mobs_at_pos(const Pos& p, vector<Mob*>& vector_ref)
 
 void add_mob(Mob* const f)
 {
-    mobs_.push_back(f);
+    mobs_.insert(f);
 }
 
 void erase_mob(Mob* const f, const bool DESTROY_OBJECT)
 {
-    for (auto it = mobs_.begin(); it != mobs_.end(); ++it)
-    {
-        if (*it == f)
-        {
-            if (DESTROY_OBJECT) {delete f;}
+    mobs_.erase(f);
 
-            mobs_.erase(it);
-            return;
-        }
-    }
+    if (DESTROY_OBJECT) {delete f;}
 }
 
 void erase_all_mobs()
@@ -251,8 +252,13 @@ void erase_actor_in_element(const size_t i)
 {
     if (!actors_.empty())
     {
-        delete actors_[i];
-        actors_.erase(actors_.begin() + i);
+        Actor* const actor = actors_[i];
+
+        actors_.erase_at(i);
+
+        delete actor;
+
+        perception::invalidate();
     }
 }
 
@@ -260,12 +266,16 @@ void add_actor(Actor* actor)
 {
     //Sanity check actor inserted
     assert(utils::is_pos_inside_map(actor->pos));
-    actors_.push_back(actor);
+    actors_.insert(actor);
+
+    perception::invalidate();
 }
 
 void reset_turn_type_and_actor_counters()
 {
     cur_turn_type_pos_ = cur_actor_index_ = 0;
+
+    perception::invalidate();
 }
 
 //For every turn type step, run through all actors and let those who can act during this
@@ -274,14 +284,29 @@ void reset_turn_type_and_actor_counters()
 //spawn more monsters etc.)
 void tick(const bool IS_FREE_TURN)
 {
+    PROFILE_SCOPE("game_time::tick");
+
     run_atomic_turn_events();
 
     auto* actor = cur_actor();
 
     if (actor == map::player)
     {
+        //What the monsters see may have changed by the player's action
+        perception::invalidate();
+
         map::player->update_fov();
-        render::draw_map_and_interface();
+
+        //While travelling or exploring, the map is drawn when the player stops
+        if (map::player->is_auto_moving())
+        {
+            render::update_seen_cells_render_data();
+        }
+        else
+        {
+            render::draw_map_and_interface();
+        }
+
         map::cpy_render_array_to_visual_memory();
 
         //Run new turn events on all player items
@@ -329,6 +354,8 @@ void tick(const bool IS_FREE_TURN)
 
                 ++cur_turn_type_pos_;
 
+                perception::invalidate();
+
                 if (cur_turn_type_pos_ == int(Turn_type::END))
                 {
                     cur_turn_type_pos_ = 0;
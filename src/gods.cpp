@@ -12,8 +12,8 @@ namespace gods
 namespace
 {
 
-vector<God> god_list;
-int         cur_god_elem_;
+vector<God>         god_list;
+thread_local int    cur_god_elem_;
 
 void init_god_list()
 {
@@ -45,6 +45,55 @@ namespace
 SDL_Event sdl_event_;
 bool is_inited_ = false;
 
+//Only the main thread may pump the window events - when the game runs on a thread of its
+//own, the events pumped by the main thread are taken from the queue
+bool poll_event()
+{
+    if (sdl_wrapper::is_main_thread())
+    {
+        return SDL_PollEvent(&sdl_event_);
+    }
+
+    return SDL_PeepEvents(&sdl_event_, 1, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT) > 0;
+}
+
+//Quick move, travel and explore are only allowed when it seems safe (otherwise a message
+//with the reason is printed)
+bool is_auto_move_allowed()
+{
+    vector<Actor*> seen_mon;
+    map::player->seen_foes(seen_mon);
+
+    string msg = "";
+
+    if (!seen_mon.empty())
+    {
+        msg = msg_mon_prevent_cmd;
+    }
+    else if (!map::player->prop_handler().allow_see())
+    {
+        msg = "Not while blind.";
+    }
+    else if (map::player->has_prop(Prop_id::poisoned))
+    {
+        msg = "Not while poisoned.";
+    }
+    else if (map::player->has_prop(Prop_id::confused))
+    {
+        msg = "Not while confused.";
+    }
+
+    if (msg.empty())
+    {
+        return true;
+    }
+
+    msg_log::add(msg);
+    render::draw_map_and_interface();
+
+    return false;
+}
+
 void query_quit()
 {
     const vector<string> quit_choices = vector<string> {"yes", "no"};
@@ -408,7 +457,7 @@ void handle_map_mode_key_press(const Key_data& d)
                                         actor &&
                                         map::player->can_see_actor(*actor))
                                     {
-                                        map::player->tgt_ = actor;
+                                        map::player->set_tgt(actor);
                                     }
 
                                     attack::ranged(map::player, map::player->pos, p, *wpn);
@@ -581,55 +630,74 @@ void handle_map_mode_key_press(const Key_data& d)
         //----------------------------------- QUICK WALK
         msg_log::clear();
 
-        if (map::player->is_alive())
+        if (map::player->is_alive() && is_auto_move_allowed())
         {
-            vector<Actor*> seen_mon;
-            map::player->seen_foes(seen_mon);
+            msg_log::add("Which direction?" + cancel_info_str);
+            render::draw_map_and_interface();
+            const Dir dir = query::dir();
+            msg_log::clear();
 
-            if (!seen_mon.empty())
+            if (dir == Dir::center)
             {
-                //Monster is seen, prevent quick move
-                msg_log::add(msg_mon_prevent_cmd);
-                render::draw_map_and_interface();
+                render::update_screen();
             }
-            else if (!map::player->prop_handler().allow_see())
+            else
             {
-                //Player is blinded
-                msg_log::add("Not while blind.");
-                render::draw_map_and_interface();
+                map::player->set_quick_move(dir);
             }
-            else //Can see
+        }
+
+        clear_events();
+        return;
+    }
+
+    else if (d.key == 'T')
+    {
+        //----------------------------------- TRAVEL
+        msg_log::clear();
+
+        if (map::player->is_alive() && is_auto_move_allowed())
+        {
+            auto on_marker_at_pos = [](const Pos & p)
             {
-                if (map::player->has_prop(Prop_id::poisoned))
-                {
-                    //Player is poisoned
-                    msg_log::add("Not while poisoned.");
-                    render::draw_map_and_interface();
-                }
-                else if (map::player->has_prop(Prop_id::confused))
+                msg_log::clear();
+                look::print_location_info_msgs(p);
+                msg_log::add("[T] to travel here." + cancel_info_str);
+            };
+
+            auto on_key_press = [](const Pos & p, const Key_data & d_)
+            {
+                if (d_.sdl_key == SDLK_RETURN || d_.key == 'T')
                 {
-                    //Player is confused
-                    msg_log::add("Not while confused.");
-                    render::draw_map_and_interface();
+                    msg_log::clear();
+                    map::player->travel_to(p);
+                    return Marker_done::yes;
                 }
-                else
+                else if (d_.sdl_key == SDLK_SPACE || d_.sdl_key == SDLK_ESCAPE)
                 {
-                    msg_log::add("Which direction?" + cancel_info_str);
-                    render::draw_map_and_interface();
-                    const Dir dir = query::dir();
                     msg_log::clear();
+                    return Marker_done::yes;
+                }
 
-                    if (dir == Dir::center)
-                    {
-                        render::update_screen();
-                    }
-                    else
-                    {
-                        map::player->set_quick_move(dir);
-                    }
+                return Marker_done::no;
+            };
 
-                }
-            }
+            marker::run(Marker_draw_tail::yes, Marker_use_player_tgt::no, on_marker_at_pos,
+                        on_key_press);
+        }
+
+        clear_events();
+        return;
+    }
+
+    else if (d.key == 'O')
+    {
+        //----------------------------------- EXPLORE
+        msg_log::clear();
+
+        if (map::player->is_alive() && is_auto_move_allowed())
+        {
+            map::player->explore();
         }
 
         clear_events();
@@ -748,7 +816,7 @@ void handle_map_mode_key_press(const Key_data& d)
 
                                     if (actor)
                                     {
-                                        map::player->tgt_ = actor;
+                                        map::player->set_tgt(actor);
                                     }
 
                                     throwing::throw_item(*map::player, p, *item_to_throw);
@@ -1180,7 +1248,7 @@ void clear_events()
 {
     if (is_inited_)
     {
-        while (SDL_PollEvent(&sdl_event_)) {}
+        while (poll_event()) {}
     }
 }
 
@@ -1193,7 +1261,14 @@ Key_data input(const bool IS_O_RETURN)
         return ret;
     }
 
-    SDL_StartTextInput();
+    //Text input is a window operation, and is kept enabled by the main thread while the game
+    //runs on another thread
+    const bool IS_MAIN_THREAD = sdl_wrapper::is_main_thread();
+
+    if (IS_MAIN_THREAD)
+    {
+        SDL_StartTextInput();
+    }
 
     bool is_done = false;
 
@@ -1201,7 +1276,7 @@ Key_data input(const bool IS_O_RETURN)
     {
         sdl_wrapper::sleep(1);
 
-        const bool DID_POLL_EVENT = SDL_PollEvent(&sdl_event_);
+        const bool DID_POLL_EVENT = poll_event();
 
         if (!DID_POLL_EVENT)
         {
@@ -1340,7 +1415,10 @@ Key_data input(const bool IS_O_RETURN)
         } //End of event type switch
     } //End of while loop
 
-    SDL_StopTextInput();
+    if (IS_MAIN_THREAD)
+    {
+        SDL_StopTextInput();
+    }
 
     return ret;
 }
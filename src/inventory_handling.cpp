@@ -23,15 +23,15 @@ using namespace std;
 namespace inv_handling
 {
 
-Inv_scr     scr_to_open_on_new_turn          = Inv_scr::END;
-Inv_slot*   equip_slot_to_open_on_new_turn   = nullptr;
-int         browser_idx_to_set_on_new_turn   = 0;
+thread_local Inv_scr     scr_to_open_on_new_turn          = Inv_scr::END;
+thread_local Inv_slot*   equip_slot_to_open_on_new_turn   = nullptr;
+thread_local int         browser_idx_to_set_on_new_turn   = 0;
 
 namespace
 {
 
 //The values in this vector refer to backpack inventory elements
-vector<size_t> backpack_items_to_show_;
+thread_local vector<size_t> backpack_items_to_show_;
 
 bool run_drop_screen(const Inv_type inv_type, const size_t ELEMENT)
 {
@@ -2,6 +2,7 @@
 
 #include <iostream>
 #include <climits>
+#include <algorithm>
 
 #include "init.hpp"
 #include "colors.hpp"
@@ -66,11 +67,6 @@ Item_data_t::Item_melee_data::Item_melee_data() :
     hit_hard_sfx                        (Sfx_id::END),
     miss_sfx                            (Sfx_id::END) {}
 
-Item_data_t::Item_melee_data::~Item_melee_data()
-{
-    if (prop_applied) {delete prop_applied;}
-}
-
 Item_data_t::Item_ranged_data::Item_ranged_data() :
     is_ranged_wpn                       (false),
     is_machine_gun                      (false),
@@ -99,14 +95,6 @@ Item_data_t::Item_ranged_data::Item_ranged_data() :
     reload_sfx                          (Sfx_id::END),
     prop_applied                        (nullptr) {}
 
-Item_data_t::Item_ranged_data::~Item_ranged_data()
-{
-    if (prop_applied)
-    {
-        delete prop_applied;
-    }
-}
-
 Item_data_t::Item_armor_data::Item_armor_data() :
     armor_points(0),
     dmg_to_durability_factor(0.0) {}
@@ -114,11 +102,14 @@ Item_data_t::Item_armor_data::Item_armor_data() :
 namespace item_data
 {
 
-Item_data_t data[int(Item_id::END)];
+thread_local Item_data_t data[int(Item_id::END)];
 
 namespace
 {
 
+//The data as it is at the start of a game, the same for all sessions (and threads)
+Item_data_t base_data_[int(Item_id::END)];
+
 void add_feature_found_in(Item_data_t& data, const Feature_id feature_id,
                           const int CHANCE_TO_INCL = 100)
 {
@@ -375,7 +366,7 @@ void init_data_list()
     d.glyph = '*';
     d.clr = clr_red_lgt;
     d.tile = Tile_id::trapezohedron;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
     d.id = Item_id::sawed_off;
@@ -405,7 +396,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
     d.id = Item_id::pump_shotgun;
@@ -433,7 +424,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ammo);
     d.id = Item_id::shotgun_shell;
@@ -446,7 +437,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
     d.id = Item_id::incinerator;
@@ -473,7 +464,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest, 25);
     add_feature_found_in(d, Feature_id::cabinet, 25);
     add_feature_found_in(d, Feature_id::cocoon, 25);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ammo_clip);
     d.id = Item_id::incinerator_ammo;
@@ -488,12 +479,12 @@ void init_data_list()
     d.weight = Item_weight::light;
     d.spawn_std_range.lower = 5;
     d.max_stack_at_spawn = 1;
-    d.ranged.max_ammo = data[size_t(Item_id::incinerator)].ranged.max_ammo;
+    d.ranged.max_ammo = base_data_[size_t(Item_id::incinerator)].ranged.max_ammo;
     d.chance_to_incl_in_floor_spawn_list = 25;
     add_feature_found_in(d, Feature_id::chest, 25);
     add_feature_found_in(d, Feature_id::cabinet, 25);
     add_feature_found_in(d, Feature_id::cocoon, 25);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
     d.id = Item_id::machine_gun;
@@ -521,7 +512,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ammo_clip);
     d.id = Item_id::drum_of_bullets;
@@ -530,11 +521,11 @@ void init_data_list()
     {
         "Ammunition used by Tommy Guns."
     };
-    d.ranged.max_ammo = data[size_t(Item_id::machine_gun)].ranged.max_ammo;
+    d.ranged.max_ammo = base_data_[size_t(Item_id::machine_gun)].ranged.max_ammo;
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
     d.id = Item_id::pistol;
@@ -558,7 +549,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ammo_clip);
     d.id = Item_id::pistol_clip;
@@ -569,11 +560,11 @@ void init_data_list()
     {
         "Ammunition used by Colt pistols."
     };
-    d.ranged.max_ammo = data[size_t(Item_id::pistol)].ranged.max_ammo;
+    d.ranged.max_ammo = base_data_[size_t(Item_id::pistol)].ranged.max_ammo;
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
     d.id = Item_id::mi_go_gun;
@@ -607,7 +598,7 @@ void init_data_list()
     d.ranged.att_sfx = Sfx_id::mi_go_gun_fire;
     d.ranged.reload_sfx = Sfx_id::machine_gun_reload;
     d.ranged.makes_ricochet_snd = false;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ammo_clip);
     d.id = Item_id::mi_go_gun_ammo;
@@ -619,10 +610,10 @@ void init_data_list()
     {
         "Ammunition for the Mi-go Electric gun."
     };
-    d.ranged.max_ammo = data[size_t(Item_id::mi_go_gun)].ranged.max_ammo;
+    d.ranged.max_ammo = base_data_[size_t(Item_id::mi_go_gun)].ranged.max_ammo;
     d.clr = clr_yellow;
     d.spawn_std_range = Range(-1, -1);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
     d.id = Item_id::flare_gun;
@@ -645,7 +636,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
     d.id = Item_id::spike_gun;
@@ -678,7 +669,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest, 50);
     add_feature_found_in(d, Feature_id::cabinet, 50);
     add_feature_found_in(d, Feature_id::cocoon, 50);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
     d.id = Item_id::trap_dart;
@@ -690,13 +681,13 @@ void init_data_list()
     d.ranged.snd_msg = "I hear the launching of a projectile.";
     d.ranged.att_sfx = Sfx_id::END; //TODO: Make a sound effect for this
     d.ranged.makes_ricochet_snd = true;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
-    d = data[size_t(Item_id::trap_dart)];
+    d = base_data_[size_t(Item_id::trap_dart)];
     d.id = Item_id::trap_dart_poison;
     d.ranged.prop_applied = new Prop_poisoned(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::trap_spear;
@@ -707,13 +698,13 @@ void init_data_list()
     d.melee.hit_small_sfx = Sfx_id::hit_sharp;
     d.melee.hit_medium_sfx = Sfx_id::hit_sharp;
     d.melee.miss_sfx = Sfx_id::miss_heavy;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn);
-    d = data[size_t(Item_id::trap_spear)];
+    d = base_data_[size_t(Item_id::trap_spear)];
     d.id = Item_id::trap_spear_poison;
     d.ranged.prop_applied = new Prop_poisoned(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::explosive);
     d.id = Item_id::dynamite;
@@ -729,7 +720,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::explosive);
     d.id = Item_id::flare;
@@ -745,7 +736,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::explosive);
     d.id = Item_id::molotov;
@@ -762,7 +753,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::explosive);
     d.id = Item_id::smoke_grenade;
@@ -779,7 +770,7 @@ void init_data_list()
     d.clr = clr_green;
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::throwing_wpn);
     d.id = Item_id::thr_knife;
@@ -802,7 +793,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::throwing_wpn);
     d.id = Item_id::rock;
@@ -823,7 +814,7 @@ void init_data_list()
     d.main_att_mode = Main_att_mode::thrown;
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::dagger;
@@ -850,7 +841,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::tomb);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::hatchet;
@@ -876,7 +867,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::club;
@@ -895,7 +886,7 @@ void init_data_list()
     d.melee.dmg = pair<int, int>(2, 3);
     d.melee.hit_chance_mod = 10;
     d.melee.miss_sfx = Sfx_id::miss_medium;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::hammer;
@@ -915,7 +906,7 @@ void init_data_list()
     d.melee.miss_sfx = Sfx_id::miss_medium;
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::machete;
@@ -936,7 +927,7 @@ void init_data_list()
     d.melee.miss_sfx = Sfx_id::miss_medium;
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::axe;
@@ -958,7 +949,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::tomb);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::pitch_fork;
@@ -979,7 +970,7 @@ void init_data_list()
     d.melee.miss_sfx = Sfx_id::miss_heavy;
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::sledge_hammer;
@@ -998,7 +989,7 @@ void init_data_list()
     d.melee.knocks_back = true;
     d.melee.miss_sfx = Sfx_id::miss_heavy;
     add_feature_found_in(d, Feature_id::cabinet);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn);
     d.id = Item_id::pharaoh_staff;
@@ -1024,7 +1015,7 @@ void init_data_list()
     d.value = Item_value::major_treasure;
     d.shock_while_in_backpack = d.shock_while_equipped = 15;
     add_feature_found_in(d, Feature_id::tomb, 20);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::throwing_wpn);
     d.id = Item_id::iron_spike;
@@ -1048,7 +1039,7 @@ void init_data_list()
     d.main_att_mode = Main_att_mode::thrown;
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::player_kick;
@@ -1057,7 +1048,7 @@ void init_data_list()
     d.melee.dmg = pair<int, int>(1, 3);
     d.melee.knocks_back = true;
     d.melee.miss_sfx = Sfx_id::miss_medium;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::player_stomp;
@@ -1065,47 +1056,47 @@ void init_data_list()
     d.melee.hit_chance_mod = 20;
     d.melee.dmg = pair<int, int>(1, 3);
     d.melee.knocks_back = false;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::player_punch;
     d.melee.att_msgs = {"punch", ""};
     d.melee.hit_chance_mod = 25;
     d.melee.dmg = pair<int, int>(1, 2);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::player_ghoul_claw;
     d.melee.att_msgs = {"claw", ""};
     d.melee.hit_chance_mod = 25;
     d.melee.dmg = pair<int, int>(2, 5);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::zombie_claw;
     d.melee.att_msgs = {"", "claws me"};
     set_dmg_from_mon_id(d, Actor_id::zombie);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::zombie_claw_diseased;
     d.melee.att_msgs = {"", "claws me"};
     set_dmg_from_mon_id(d, Actor_id::zombie);
     d.melee.prop_applied = new Prop_infected(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::zombie_axe;
     d.melee.att_msgs = {"", "chops me with a rusty axe"};
     set_dmg_from_mon_id(d, Actor_id::zombie_axe);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::bloated_zombie_punch;
     d.melee.att_msgs = {"", "mauls me"};
     set_dmg_from_mon_id(d, Actor_id::bloated_zombie);
     d.melee.knocks_back = true;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn_intr);
     d.id = Item_id::bloated_zombie_spit;
@@ -1115,77 +1106,77 @@ void init_data_list()
     d.ranged.projectile_clr = clr_green_lgt;
     d.ranged.dmg_type = Dmg_type::acid;
     d.ranged.projectile_glyph = '*';
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::rat_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::rat);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::rat_bite_diseased;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::rat);
     d.melee.prop_applied = new Prop_infected(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::rat_thing_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::rat_thing);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::brown_jenkin_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::brown_jenkin);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::worm_mass_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::worm_mass);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::wolf_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::wolf);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::green_spider_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::green_spider);
     d.melee.prop_applied = new Prop_blind(Prop_turns::specific, 4);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::white_spider_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::white_spider);
     d.melee.prop_applied = new Prop_paralyzed(Prop_turns::specific, 2);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::red_spider_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::red_spider);
     d.melee.prop_applied = new Prop_weakened(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::shadow_spider_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::shadow_spider);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::leng_spider_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::leng_spider);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn_intr);
     d.id = Item_id::fire_hound_breath;
@@ -1198,14 +1189,14 @@ void init_data_list()
     d.ranged.projectile_leaves_trail = true;
     d.ranged.projectile_leaves_smoke = true;
     d.ranged.dmg_type = Dmg_type::fire;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::fire_hound_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::fire_hound);
     d.melee.dmg_type = Dmg_type::fire;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn_intr);
     d.id = Item_id::frost_hound_breath;
@@ -1217,41 +1208,41 @@ void init_data_list()
     d.ranged.projectile_leaves_trail = true;
     d.ranged.projectile_leaves_smoke = true;
     d.ranged.dmg_type = Dmg_type::cold;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::frost_hound_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::frost_hound);
     d.melee.dmg_type = Dmg_type::cold;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::zuul_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::zuul);
     d.melee.dmg_type = Dmg_type::physical;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::dust_vortex_engulf;
     d.melee.att_msgs = {"", "engulfs me"};
     set_dmg_from_mon_id(d, Actor_id::dust_vortex);
     d.melee.prop_applied = new Prop_blind(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::fire_vortex_engulf;
     d.melee.att_msgs = {"", "engulfs me"};
     set_dmg_from_mon_id(d, Actor_id::fire_vortex);
     d.melee.prop_applied = new Prop_burning(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::frost_vortex_engulf;
     d.melee.att_msgs = {"", "engulfs me"};
     set_dmg_from_mon_id(d, Actor_id::frost_vortex);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::ghost_claw;
@@ -1259,7 +1250,7 @@ void init_data_list()
     set_dmg_from_mon_id(d, Actor_id::ghost);
     d.melee.prop_applied = new Prop_terrified(Prop_turns::specific, 4);
     d.melee.dmg_type = Dmg_type::spirit;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::phantasm_sickle;
@@ -1267,7 +1258,7 @@ void init_data_list()
     set_dmg_from_mon_id(d, Actor_id::phantasm);
     d.melee.prop_applied = new Prop_terrified(Prop_turns::specific, 4);
     d.melee.dmg_type = Dmg_type::spirit;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::wraith_claw;
@@ -1275,58 +1266,58 @@ void init_data_list()
     set_dmg_from_mon_id(d, Actor_id::wraith);
     d.melee.prop_applied = new Prop_terrified(Prop_turns::specific, 4);
     d.melee.dmg_type = Dmg_type::spirit;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::giant_bat_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::giant_bat);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::polyp_tentacle;
     d.melee.att_msgs = {"", "grips me with a tentacle"};
     d.melee.prop_applied = new Prop_paralyzed(Prop_turns::specific, 1);
     set_dmg_from_mon_id(d, Actor_id::flying_polyp);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::greater_polyp_tentacle;
     d.melee.att_msgs = {"", "grips me with a tentacle"};
     d.melee.prop_applied = new Prop_paralyzed(Prop_turns::specific, 1);
     set_dmg_from_mon_id(d, Actor_id::greater_polyp);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::ghoul_claw;
     d.melee.att_msgs = {"", "claws me"};
     set_dmg_from_mon_id(d, Actor_id::ghoul);
     d.melee.prop_applied = new Prop_infected(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::shadow_claw;
     d.melee.att_msgs = {"", "claws me"};
     set_dmg_from_mon_id(d, Actor_id::shadow);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::byakhee_claw;
     d.melee.att_msgs = {"", "claws me"};
     set_dmg_from_mon_id(d, Actor_id::byakhee);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::giant_mantis_claw;
     d.melee.att_msgs = {"", "claws me"};
     set_dmg_from_mon_id(d, Actor_id::giant_mantis);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::giant_locust_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::locust);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::mummy_maul;
@@ -1334,13 +1325,13 @@ void init_data_list()
     set_dmg_from_mon_id(d, Actor_id::mummy);
     d.melee.prop_applied = new Prop_cursed(Prop_turns::std);
     d.melee.knocks_back = true;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::croc_head_mummy_spear;
     d.melee.att_msgs = {"", "hits me with a spear"};
     set_dmg_from_mon_id(d, Actor_id::croc_head_mummy);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ranged_wpn_intr);
     d.id = Item_id::deep_one_javelin_att;
@@ -1350,99 +1341,99 @@ void init_data_list()
     d.ranged.projectile_clr = clr_brown;
     d.ranged.projectile_glyph = '/';
     d.ranged.snd_vol = Snd_vol::low;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::deep_one_spear_att;
     d.melee.att_msgs = {"", "hits me with a spear"};
     set_dmg_from_mon_id(d, Actor_id::deep_one);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::ape_maul;
     d.melee.att_msgs = {"", "mauls me"};
     set_dmg_from_mon_id(d, Actor_id::ape);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::ooze_black_spew_pus;
     d.melee.att_msgs = {"", "spews pus on me"};
     set_dmg_from_mon_id(d, Actor_id::ooze_black);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::ooze_clear_spew_pus;
     d.melee.att_msgs = {"", "spews pus on me"};
     set_dmg_from_mon_id(d, Actor_id::ooze_clear);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::ooze_putrid_spew_pus;
     d.melee.att_msgs = {"", "spews infected pus on me"};
     set_dmg_from_mon_id(d, Actor_id::ooze_putrid);
     d.melee.prop_applied = new Prop_infected(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::ooze_poison_spew_pus;
     d.melee.att_msgs = {"", "spews poisonous pus on me"};
     set_dmg_from_mon_id(d, Actor_id::ooze_poison);
     d.melee.prop_applied = new Prop_poisoned(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::color_oo_space_touch;
     d.melee.att_msgs = {"", "touches me"};
     set_dmg_from_mon_id(d, Actor_id::color_oo_space);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::chthonian_bite;
     d.melee.att_msgs = {"", "strikes me with a tentacle"};
     d.melee.knocks_back = true;
     set_dmg_from_mon_id(d, Actor_id::chthonian);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::death_fiend_claw;
     d.melee.att_msgs = {"", "claws me"};
     set_dmg_from_mon_id(d, Actor_id::death_fiend);
     d.melee.dmg_type = Dmg_type::pure;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::hunting_horror_bite;
     d.melee.att_msgs = {"", "bites me"};
     set_dmg_from_mon_id(d, Actor_id::hunting_horror);
     d.melee.prop_applied = new Prop_poisoned(Prop_turns::std);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::mold_spores;
     d.melee.att_msgs = {"", "releases spores at me"};
     set_dmg_from_mon_id(d, Actor_id::mold);
     d.melee.prop_applied = new Prop_poisoned(Prop_turns::specific, POISON_DMG_N_TURN * 2);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::mi_go_sting;
     d.melee.att_msgs = {"", "stings me"};
     set_dmg_from_mon_id(d, Actor_id::mi_go);
     d.melee.prop_applied = new Prop_poisoned(Prop_turns::specific, POISON_DMG_N_TURN * 2);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::mi_go_commander_sting;
     d.melee.att_msgs = {"", "stings me"};
     set_dmg_from_mon_id(d, Actor_id::mi_go_commander);
     d.melee.prop_applied = new Prop_poisoned(Prop_turns::specific, POISON_DMG_N_TURN * 2);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::melee_wpn_intr);
     d.id = Item_id::the_high_priest_claw;
     d.melee.att_msgs = {"", "claws me"};
     set_dmg_from_mon_id(d, Actor_id::the_high_priest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::armor);
     d.id = Item_id::armor_leather_jacket;
@@ -1458,7 +1449,7 @@ void init_data_list()
     d.armor.dmg_to_durability_factor = 1.0;
     d.land_on_hard_snd_msg = "";
     add_feature_found_in(d, Feature_id::cabinet);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::armor);
     d.id = Item_id::armor_iron_suit;
@@ -1484,7 +1475,7 @@ void init_data_list()
     d.armor.dmg_to_durability_factor = 0.3;
     d.land_on_hard_snd_msg = "I hear a crashing sound.";
     add_feature_found_in(d, Feature_id::cabinet);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::armor);
     d.id = Item_id::armor_flack_jacket;
@@ -1504,7 +1495,7 @@ void init_data_list()
     d.armor.dmg_to_durability_factor = 0.5;
     d.land_on_hard_snd_msg = "I hear a thudding sound.";
     add_feature_found_in(d, Feature_id::cabinet);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::armor);
     d.id = Item_id::armor_asb_suit;
@@ -1533,7 +1524,7 @@ void init_data_list()
     d.land_on_hard_snd_msg = "";
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::chest);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::armor);
     d.id = Item_id::armor_heavy_coat;
@@ -1555,7 +1546,7 @@ void init_data_list()
     d.armor.dmg_to_durability_factor = 1.0;
     d.land_on_hard_snd_msg = "";
     add_feature_found_in(d, Feature_id::cabinet);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::armor);
     d.id = Item_id::armor_mi_go;
@@ -1574,7 +1565,7 @@ void init_data_list()
     d.armor.armor_points = 2;
     d.armor.dmg_to_durability_factor = 1.5;
     d.land_on_hard_snd_msg = "";
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::head_wear);
     d.id = Item_id::gas_mask;
@@ -1598,7 +1589,7 @@ void init_data_list()
     d.chance_to_incl_in_floor_spawn_list = 50;
     d.weight = Item_weight::light;
     d.land_on_hard_snd_msg = "";
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
 //    reset_data(d, Item_type::head_wear);
 //    d.id = Item_id::hideous_mask;
@@ -1620,153 +1611,153 @@ void init_data_list()
 //    d.value = Item_value::major_treasure;
 //    d.shock_while_in_backpack = d.shock_while_equipped = 15;
 //    add_feature_found_in(d, Feature_id::tomb, 8);
-//    data[size_t(d.id)] = d;
+//    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_mayhem;
     d.spell_cast_from_scroll = Spell_id::mayhem;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_telep;
     d.spell_cast_from_scroll = Spell_id::teleport;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_pest;
     d.spell_cast_from_scroll = Spell_id::pest;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_slow_mon;
     d.spell_cast_from_scroll = Spell_id::slow_mon;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_terrify_mon;
     d.spell_cast_from_scroll = Spell_id::terrify_mon;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_paral_mon;
     d.spell_cast_from_scroll = Spell_id::paralyze_mon;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_det_items;
     d.spell_cast_from_scroll = Spell_id::det_items;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_det_traps;
     d.spell_cast_from_scroll = Spell_id::det_traps;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_bless;
     d.spell_cast_from_scroll = Spell_id::bless;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_darkbolt;
     d.spell_cast_from_scroll = Spell_id::darkbolt;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_aza_wrath;
     d.spell_cast_from_scroll = Spell_id::aza_wrath;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_opening;
     d.spell_cast_from_scroll = Spell_id::opening;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_sacr_life;
     d.spell_cast_from_scroll = Spell_id::sacr_life;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_sacr_spi;
     d.spell_cast_from_scroll = Spell_id::sacr_spi;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_det_mon;
     d.spell_cast_from_scroll = Spell_id::det_mon;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_elem_res;
     d.spell_cast_from_scroll = Spell_id::elem_res;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_summon_mon;
     d.spell_cast_from_scroll = Spell_id::summon;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::scroll);
     d.id = Item_id::scroll_light;
     d.spell_cast_from_scroll = Spell_id::light;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_vitality;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_spirit;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_blindness;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_frenzy;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_fortitude;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_paralyze;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_rElec;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_conf;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_poison;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_insight;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_clairv;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_rFire;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_antidote;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::potion);
     d.id = Item_id::potion_descent;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::device);
     d.id = Item_id::device_blaster;
@@ -1776,7 +1767,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest, 10);
     add_feature_found_in(d, Feature_id::tomb, 10);
     add_feature_found_in(d, Feature_id::cocoon, 10);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::device);
     d.id = Item_id::device_shockwave;
@@ -1789,7 +1780,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest, 10);
     add_feature_found_in(d, Feature_id::tomb, 10);
     add_feature_found_in(d, Feature_id::cocoon, 10);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::device);
     d.id = Item_id::device_rejuvenator;
@@ -1802,7 +1793,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest, 10);
     add_feature_found_in(d, Feature_id::tomb, 10);
     add_feature_found_in(d, Feature_id::cocoon, 10);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::device);
     d.id = Item_id::device_translocator;
@@ -1815,7 +1806,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest, 10);
     add_feature_found_in(d, Feature_id::tomb, 10);
     add_feature_found_in(d, Feature_id::cocoon, 10);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::device);
     d.id = Item_id::device_sentry_drone;
@@ -1828,7 +1819,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest, 10);
     add_feature_found_in(d, Feature_id::tomb, 10);
     add_feature_found_in(d, Feature_id::cocoon, 10);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::device);
     d.id = Item_id::electric_lantern;
@@ -1847,7 +1838,7 @@ void init_data_list()
     add_feature_found_in(d, Feature_id::chest);
     add_feature_found_in(d, Feature_id::cabinet);
     add_feature_found_in(d, Feature_id::cocoon);
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::general);
     d.id = Item_id::medical_bag;
@@ -1862,140 +1853,140 @@ void init_data_list()
     d.glyph = '~';
     d.clr = clr_brown_drk;
     d.tile = Tile_id::medical_bag;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::amulet);
     d.id = Item_id::star_amulet;
     d.base_name = {"Star Amulet", "", "a Star Amulet"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_white;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::amulet);
     d.id = Item_id::skull_amulet;
     d.base_name = {"Skull Amulet", "", "a Skull Amulet"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_white;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::amulet);
     d.id = Item_id::spider_amulet;
     d.base_name = {"Spider Amulet", "", "a Spider Amulet"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_white;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::amulet);
     d.id = Item_id::eye_amulet;
     d.base_name = {"Eye Amulet", "", "an Eye Amulet"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_white;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::amulet);
     d.id = Item_id::moon_amulet;
     d.base_name = {"Moon Amulet", "", "a Moon Amulet"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_white;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::amulet);
     d.id = Item_id::bat_amulet;
     d.base_name = {"Bat Amulet", "", "a Bat Amulet"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_white;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::amulet);
     d.id = Item_id::scarab_amulet;
     d.base_name = {"Scarab Amulet", "", "a Scarab Amulet"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_white;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::amulet);
     d.id = Item_id::dagger_amulet;
     d.base_name = {"Dagger Amulet", "", "a Dagger Amulet"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_white;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::golden_ring;
     d.base_name = {"Golden Ring", "", "a Golden Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_yellow;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::silver_ring;
     d.base_name = {"Silver Ring", "", "a Silver Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_white;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::carnelian_ring;
     d.base_name = {"Carnelian Ring", "", "a Carnelian Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_red_lgt;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::garnet_ring;
     d.base_name = {"Garnet Ring", "", "a Garnet Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_red_lgt;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::iron_ring;
     d.base_name = {"Iron Ring", "", "an Iron Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_gray;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::jade_ring;
     d.base_name = {"Jade Ring", "", "a Jade Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_green_lgt;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::moonstone_ring;
     d.base_name = {"Moonstone Ring", "", "a Moonstone Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_blue_lgt;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::obsidian_ring;
     d.base_name = {"Obsidian Ring", "", "an Obsidian Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_gray;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::onyx_ring;
     d.base_name = {"Onyx Ring", "", "an Onyx Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_gray;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::topaz_ring;
     d.base_name = {"Topaz Ring", "", "a Topaz Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_blue_lgt;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 
     reset_data(d, Item_type::ring);
     d.id = Item_id::emerald_ring;
     d.base_name = {"Emerald Ring", "", "an Emerald Ring"};
     d.base_name_un_id = d.base_name;
     d.clr = clr_green_lgt;
-    data[size_t(d.id)] = d;
+    base_data_[size_t(d.id)] = d;
 }
 
 } //namespace
@@ -2004,7 +1995,14 @@ void init()
 {
     TRACE_FUNC_BEGIN;
 
-    init_data_list();
+    //Building the data list is slow, so it is only done once per process. Each session
+    //gets a copy, which is modified during the game (e.g. which items are identified, or
+    //the randomized names of scrolls).
+    static const bool IS_BASE_DATA_BUILT = (init_data_list(), true);
+
+    (void)IS_BASE_DATA_BUILT;
+
+    std::copy(std::begin(base_data_), std::end(base_data_), std::begin(data));
 
     TRACE_FUNC_END;
 }
@@ -15,8 +15,8 @@
 namespace
 {
 
-Item_id     effect_list_    [size_t(Jewelry_effect_id::END)];
-bool        effects_known_  [size_t(Jewelry_effect_id::END)];
+thread_local Item_id     effect_list_    [size_t(Jewelry_effect_id::END)];
+thread_local bool        effects_known_  [size_t(Jewelry_effect_id::END)];
 
 Jewelry_effect* mk_effect(const Jewelry_effect_id id, Jewelry* const jewelry)
 {
@@ -356,7 +356,7 @@ void Jewelry_effect_conflict::on_std_turn_equipped()
 
         if (!seen_foes.empty())
         {
-            std::random_shuffle(begin(seen_foes), end(seen_foes));
+            rnd::shuffle(seen_foes);
 
             for (Actor* actor : seen_foes)
             {
@@ -876,7 +876,7 @@ void init()
         }
     }
 
-    std::random_shuffle(begin(item_bucket), end(item_bucket));
+    rnd::shuffle(item_bucket);
 
     std::vector<Jewelry_effect_id> primary_effect_bucket;
     std::vector<Jewelry_effect_id> secondary_effect_bucket;
@@ -895,8 +895,8 @@ void init()
         }
     }
 
-    random_shuffle(begin(primary_effect_bucket),   end(primary_effect_bucket));
-    random_shuffle(begin(secondary_effect_bucket), end(secondary_effect_bucket));
+    rnd::shuffle(primary_effect_bucket);
+    rnd::shuffle(secondary_effect_bucket);
 
     //Assuming there are more jewelry than primary or secondary effects (if this changes,
     //just add more amulets and rings to the item data)
@@ -546,6 +546,7 @@ void Potion_clairv::quaff_impl(Actor& actor)
                 {
                     cell.is_explored = true;
                     cell.is_seen_by_player = true;
+                    map::player->mark_unmemorized(Pos(x, y));
                     anim_cells.push_back(Pos(x, y));
                 }
             }
@@ -585,7 +586,7 @@ namespace potion_handling
 namespace
 {
 
-vector<Potion_look> potion_looks_;
+thread_local vector<Potion_look> potion_looks_;
 
 } //namespace
 
@@ -2,6 +2,7 @@
 
 #include <string>
 #include <cassert>
+#include <algorithm>
 
 #include "init.hpp"
 #include "actor_player.hpp"
@@ -152,39 +153,33 @@ namespace scroll_handling
 namespace
 {
 
-vector<string> false_names_;
-
-} //namespace
-
-void init()
+vector<string> mk_false_names()
 {
-    TRACE_FUNC_BEGIN;
-
-    //Init possible fake names
-    false_names_.clear();
-    false_names_.push_back("Cruensseasrjit");
-    false_names_.push_back("Rudsceleratus");
-    false_names_.push_back("Rudminuox");
-    false_names_.push_back("Cruo-stragara_na");
-    false_names_.push_back("Praya_navita");
-    false_names_.push_back("Pretiacruento");
-    false_names_.push_back("Pestis cruento");
-    false_names_.push_back("Cruento pestis");
-    false_names_.push_back("Domus-bhaava");
-    false_names_.push_back("Acerbus-shatruex");
-    false_names_.push_back("Pretaanluxis");
-    false_names_.push_back("Praa_nsilenux");
-    false_names_.push_back("Quodpipax");
-    false_names_.push_back("Lokemundux");
-    false_names_.push_back("Profanuxes");
-    false_names_.push_back("Shaantitus");
-    false_names_.push_back("Geropayati");
-    false_names_.push_back("Vilomaxus");
-    false_names_.push_back("Bhuudesco");
-    false_names_.push_back("Durbentia");
-    false_names_.push_back("Bhuuesco");
-    false_names_.push_back("Maravita");
-    false_names_.push_back("Infirmux");
+    vector<string> names;
+
+    names.push_back("Cruensseasrjit");
+    names.push_back("Rudsceleratus");
+    names.push_back("Rudminuox");
+    names.push_back("Cruo-stragara_na");
+    names.push_back("Praya_navita");
+    names.push_back("Pretiacruento");
+    names.push_back("Pestis cruento");
+    names.push_back("Cruento pestis");
+    names.push_back("Domus-bhaava");
+    names.push_back("Acerbus-shatruex");
+    names.push_back("Pretaanluxis");
+    names.push_back("Praa_nsilenux");
+    names.push_back("Quodpipax");
+    names.push_back("Lokemundux");
+    names.push_back("Profanuxes");
+    names.push_back("Shaantitus");
+    names.push_back("Geropayati");
+    names.push_back("Vilomaxus");
+    names.push_back("Bhuudesco");
+    names.push_back("Durbentia");
+    names.push_back("Bhuuesco");
+    names.push_back("Maravita");
+    names.push_back("Infirmux");
 
     vector<string> cmb;
     cmb.clear();
@@ -221,11 +216,33 @@ void init()
         {
             if (i != ii)
             {
-                false_names_.push_back(cmb[i] + " " + cmb[ii]);
+                names.push_back(cmb[i] + " " + cmb[ii]);
             }
         }
     }
 
+    return names;
+}
+
+//The possible fake names are the same for all sessions, so they are only made once
+const vector<string>& false_names()
+{
+    static const vector<string> names = mk_false_names();
+
+    return names;
+}
+
+} //namespace
+
+void init()
+{
+    TRACE_FUNC_BEGIN;
+
+    const vector<string>& names = false_names();
+
+    //Indices of the names already used (sorted), these are skipped when picking
+    vector<size_t> used_names;
+
     TRACE << "Init scroll names" << endl;
 
     for (auto& d : item_data::data)
@@ -233,10 +250,24 @@ void init()
         if (d.type == Item_type::scroll)
         {
             //False name
-            const int NR_ELEMENTS = false_names_.size();
-            const int ELEMENT     = rnd::range(0, NR_ELEMENTS - 1);
+            const int NR_ELEMENTS = names.size() - used_names.size();
 
-            const string& TITLE = false_names_[ELEMENT];
+            size_t element = rnd::range(0, NR_ELEMENTS - 1);
+
+            for (const size_t USED : used_names)
+            {
+                if (USED > element)
+                {
+                    break;
+                }
+
+                ++element;
+            }
+
+            used_names.insert(upper_bound(begin(used_names), end(used_names), element),
+                              element);
+
+            const string& TITLE = names[element];
 
             d.base_name_un_id.names[int(Item_ref_type::plain)] =
                 "Manuscript titled "    + TITLE;
@@ -247,8 +278,6 @@ void init()
             d.base_name_un_id.names[int(Item_ref_type::a)] =
                 "a Manuscript titled "  + TITLE;
 
-            false_names_.erase(false_names_.begin() + ELEMENT);
-
             //True name
             const Scroll* const scroll =
                 static_cast<const Scroll*>(item_factory::mk(d.id, 1));
@@ -13,62 +13,199 @@ namespace line_calc
 namespace
 {
 
-double      fov_abs_distances_[FOV_MAX_W_INT][FOV_MAX_W_INT];
-vector<Pos> fov_delta_lines_[FOV_MAX_W_INT][FOV_MAX_W_INT];
+const double STEP_SIZE_DB = 0.04;
+
+//The distances are floored, so they fit in a byte
+uint8_t     fov_abs_distances_[FOV_MAX_W_INT][FOV_MAX_W_INT];
+
+//All FOV delta lines are stored after each other in one buffer
+vector<Line_delta>  fov_line_deltas_;
+Delta_line          fov_delta_lines_[FOV_MAX_W_INT][FOV_MAX_W_INT];
+
+bool is_init_ = false;
 
 } //Namespace
 
-void init()
+Line_iter::Line_iter(const Pos& origin, const Pos& tgt,
+                     const bool SHOULD_STOP_AT_TARGET, const int CHEB_TRAVEL_LIMIT,
+                     const bool ALLOW_OUTSIDE_MAP) :
+    origin_                 (origin),
+    tgt_                    (tgt),
+    SHOULD_STOP_AT_TARGET_  (SHOULD_STOP_AT_TARGET),
+    CHEB_TRAVEL_LIMIT_      (CHEB_TRAVEL_LIMIT),
+    ALLOW_OUTSIDE_MAP_      (ALLOW_OUTSIDE_MAP),
+    delta_line_             (nullptr),
+    delta_idx_              (0),
+    x_incr_                 (0.0),
+    y_incr_                 (0.0),
+    cur_x_                  (double(origin.x) + 0.5),
+    cur_y_                  (double(origin.y) + 0.5),
+    nr_steps_               (0.0),
+    prev_                   (-1, -1),
+    has_prev_               (false),
+    is_done_                (false)
 {
-    //----------------------------------------------------------
-    //Calculate FOV absolute distances
-    for (int y = 0; y < FOV_MAX_W_INT; ++y)
+    const Pos delta(tgt - origin);
+
+    //The precalculated lines stop at the target, and are never cut short by the limit
+    if (
+        is_init_                                            &&
+        SHOULD_STOP_AT_TARGET                               &&
+        utils::king_dist(origin, tgt) < CHEB_TRAVEL_LIMIT   &&
+        abs(delta.x) <= FOV_MAX_RADI_INT                    &&
+        abs(delta.y) <= FOV_MAX_RADI_INT)
     {
-        for (int x = 0; x < FOV_MAX_W_INT; ++x)
+        delta_line_ = &fov_delta_lines_[delta.x + FOV_MAX_RADI_INT][delta.y + FOV_MAX_RADI_INT];
+    }
+    else if (tgt != origin)
+    {
+        const double DELTA_X_DB = double(delta.x);
+        const double DELTA_Y_DB = double(delta.y);
+
+        const double HYPOT_DB   = sqrt((DELTA_X_DB * DELTA_X_DB) + (DELTA_Y_DB * DELTA_Y_DB));
+
+        x_incr_ = DELTA_X_DB / HYPOT_DB;
+        y_incr_ = DELTA_Y_DB / HYPOT_DB;
+    }
+}
+
+bool Line_iter::next(Pos& out)
+{
+    if (is_done_)
+    {
+        return false;
+    }
+
+    if (tgt_ == origin_)
+    {
+        out         = origin_;
+        is_done_    = true;
+        return true;
+    }
+
+    if (delta_line_)
+    {
+        if (delta_idx_ >= delta_line_->size())
         {
-            fov_abs_distances_[x][y] = 0;
+            is_done_ = true;
+            return false;
         }
+
+        out = origin_ + (*delta_line_)[delta_idx_];
+
+        ++delta_idx_;
+
+        if (!ALLOW_OUTSIDE_MAP_ && !utils::is_pos_inside_map(out))
+        {
+            is_done_ = true;
+            return false;
+        }
+
+        return true;
     }
 
-    double delta_x, delta_y, hypot;
+    Pos cur_pos;
 
-    //delta_x corresponds to i - FOV_MAX_W_INT, and vice versa for delta_y and j.
-    //So:
-    //i = 0                 => delta_x = -FOV_MAX_W_INT
-    //i = FOV_MAX_W_INT * 2 => delta_x =  FOV_MAX_W_INT
+    while (nr_steps_ <= 9999.0)
+    {
+        nr_steps_ += STEP_SIZE_DB;
 
-    const int R_INT = FOV_MAX_RADI_INT;
+        cur_x_ += x_incr_ * STEP_SIZE_DB;
+        cur_y_ += y_incr_ * STEP_SIZE_DB;
+
+        cur_pos.set(floor(cur_x_), floor(cur_y_));
+
+        if (!ALLOW_OUTSIDE_MAP_ && !utils::is_pos_inside_map(cur_pos))
+        {
+            is_done_ = true;
+            return false;
+        }
+
+        //Check distance limits (the last position is still included)
+        is_done_ = (SHOULD_STOP_AT_TARGET_ && cur_pos == tgt_) ||
+                   utils::king_dist(origin_, cur_pos) >= CHEB_TRAVEL_LIMIT_;
 
-    for (int x = 0; x <= R_INT * 2; ++x)
+        if (!has_prev_ || cur_pos != prev_)
+        {
+            prev_       = cur_pos;
+            has_prev_   = true;
+            out         = cur_pos;
+            return true;
+        }
+
+        if (is_done_)
+        {
+            return false;
+        }
+    }
+
+    is_done_ = true;
+    return false;
+}
+
+void init()
+{
+    is_init_ = false;
+
+    //----------------------------------------------------------
+    //Calculate FOV absolute distances
+    for (int x = 0; x < FOV_MAX_W_INT; ++x)
     {
-        for (int y = 0; y <= R_INT * 2; ++y)
+        for (int y = 0; y < FOV_MAX_W_INT; ++y)
         {
-            delta_x = double(x);
-            delta_x -= FOV_MAX_RADI_DB;
-            delta_y = double(y);
-            delta_y -= FOV_MAX_RADI_DB;
-            hypot = sqrt((delta_x * delta_x) + (delta_y * delta_y));
-            fov_abs_distances_[x][y] = floor(hypot);
+            const double DELTA_X = double(x) - FOV_MAX_RADI_DB;
+            const double DELTA_Y = double(y) - FOV_MAX_RADI_DB;
+
+            fov_abs_distances_[x][y] = uint8_t(floor(sqrt((DELTA_X * DELTA_X) +
+                                                          (DELTA_Y * DELTA_Y))));
         }
     }
 
     //----------------------------------------------------------
     //Calculate FOV delta lines
+    const int R_INT = FOV_MAX_RADI_INT;
+
+    vector<size_t>  offsets;
+    vector<Pos>     cur_line;
+
+    fov_line_deltas_.clear();
+
     for (int delta_x = -R_INT; delta_x <= R_INT; delta_x++)
     {
         for (int delta_y = -R_INT; delta_y <= R_INT; delta_y++)
         {
-            const Pos origin(0, 0);
-            const Pos tgt(Pos(delta_x, delta_y));
-            vector<Pos> cur_line;
-            calc_new_line(origin, tgt, true, 999, true, cur_line);
-            fov_delta_lines_[delta_x + R_INT][delta_y + R_INT] = cur_line;
+            calc_new_line(Pos(0, 0), Pos(delta_x, delta_y), true, 999, true, cur_line);
+
+            offsets.push_back(fov_line_deltas_.size());
+
+            for (const Pos& p : cur_line)
+            {
+                fov_line_deltas_.push_back({int8_t(p.x), int8_t(p.y)});
+            }
+        }
+    }
+
+    //The pointers are set up when the buffer will not grow anymore
+    size_t i = 0;
+
+    for (int x = 0; x < FOV_MAX_W_INT; ++x)
+    {
+        for (int y = 0; y < FOV_MAX_W_INT; ++y)
+        {
+            const size_t OFFSET = offsets[i];
+            const size_t END    = (i + 1) < offsets.size() ? offsets[i + 1] :
+                                  fov_line_deltas_.size();
+
+            fov_delta_lines_[x][y] = Delta_line(fov_line_deltas_.data() + OFFSET, END - OFFSET);
+
+            ++i;
         }
     }
+
+    is_init_ = true;
 }
 
-const vector<Pos>* fov_delta_line(const Pos& delta,
-                                  const double& MAX_DIST_ABS)
+const Delta_line* fov_delta_line(const Pos& delta, const double& MAX_DIST_ABS)
 {
     const int X = delta.x + FOV_MAX_RADI_INT;
     const int Y = delta.y + FOV_MAX_RADI_INT;
@@ -90,64 +227,13 @@ void calc_new_line(const Pos& origin, const Pos& tgt,
 {
     line_ref.clear();
 
-    if (tgt == origin)
-    {
-        line_ref.push_back(origin);
-        return;
-    }
-
-    const double DELTA_X_DB = double(tgt.x - origin.x);
-    const double DELTA_Y_DB = double(tgt.y - origin.y);
+    Line_iter line(origin, tgt, SHOULD_STOP_AT_TARGET, CHEB_TRAVEL_LIMIT, ALLOW_OUTSIDE_MAP);
 
-    const double HYPOT_DB   = sqrt((DELTA_X_DB * DELTA_X_DB) + (DELTA_Y_DB * DELTA_Y_DB));
+    Pos p;
 
-    const double X_INCR_DB  = (DELTA_X_DB / HYPOT_DB);
-    const double Y_INCR_DB  = (DELTA_Y_DB / HYPOT_DB);
-
-    double cur_x_db = double(origin.x) + 0.5;
-    double cur_y_db = double(origin.y) + 0.5;
-
-    Pos cur_pos = Pos(int(cur_x_db), int(cur_y_db));
-
-    const double STEP_SIZE_DB = 0.04;
-
-    for (double i = 0.0; i <= 9999.0; i += STEP_SIZE_DB)
+    while (line.next(p))
     {
-        cur_x_db += X_INCR_DB * STEP_SIZE_DB;
-        cur_y_db += Y_INCR_DB * STEP_SIZE_DB;
-
-        cur_pos.set(floor(cur_x_db), floor(cur_y_db));
-
-        if (!ALLOW_OUTSIDE_MAP && !utils::is_pos_inside_map(cur_pos)) {return;}
-
-        bool is_pos_ok_to_add = false;
-
-        if (line_ref.empty())
-        {
-            is_pos_ok_to_add = true;
-        }
-        else
-        {
-            is_pos_ok_to_add = line_ref.back() != cur_pos;
-        }
-
-        if (is_pos_ok_to_add)
-        {
-            line_ref.push_back(cur_pos);
-        }
-
-        //Check distance limits
-        if (SHOULD_STOP_AT_TARGET && (cur_pos == tgt))
-        {
-            return;
-        }
-
-        const int DISTANCE_TRAVELED = utils::king_dist(origin.x, origin.y, cur_pos.x, cur_pos.y);
-
-        if (DISTANCE_TRAVELED >= CHEB_TRAVEL_LIMIT)
-        {
-            return;
-        }
+        line_ref.push_back(p);
     }
 }
 
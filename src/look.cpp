@@ -18,6 +18,7 @@
 #include "utils.hpp"
 #include "feature_mob.hpp"
 #include "feature_rigid.hpp"
+#include "fire_smoke.hpp"
 
 namespace auto_descr_actor
 {
@@ -110,6 +111,11 @@ void print_location_info_msgs(const Pos& pos)
 
         msg_log::add(str + ".");
 
+        if (fire_smoke::is_smoke_at(pos))
+        {
+            msg_log::add("Smoke.");
+        }
+
         //Describe mobile features.
         for (auto* mob : game_time::mobs_)
         {
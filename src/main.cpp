@@ -20,22 +20,28 @@
 #include "postmortem.hpp"
 #include "map.hpp"
 #include "utils.hpp"
+#include "profiler.hpp"
+#include "alloc_tracking.hpp"
 
 using namespace std;
 
-#ifdef _WIN32
-#undef main
-#endif
-int main(int argc, char* argv[])
+namespace
 {
-    TRACE_FUNC_BEGIN;
 
-    (void)argc;
-    (void)argv;
+int run_game(void* data)
+{
+    (void)data;
 
-    init::init_iO();
     init::init_game();
 
+#ifdef PROFILER
+    profiler::init("profile");
+#endif // PROFILER
+
+#ifdef ALLOC_TRACKING
+    alloc_tracking::init("alloc_lvls.csv");
+#endif // ALLOC_TRACKING
+
     bool quit_game = false;
 
     while (!quit_game)
@@ -152,11 +158,62 @@ int main(int argc, char* argv[])
         init::cleanup_session();
     }
 
+#ifdef PROFILER
+    profiler::cleanup();
+#endif // PROFILER
+
+#ifdef ALLOC_TRACKING
+    alloc_tracking::cleanup();
+#endif // ALLOC_TRACKING
+
     init::cleanup_game();
+
+    render::stop_present_loop();
+
+    return 0;
+}
+
+} //Namespace
+
+#ifdef _WIN32
+#undef main
+#endif
+int main(int argc, char* argv[])
+{
+    TRACE_FUNC_BEGIN;
+
+    (void)argc;
+    (void)argv;
+
+    init::init_iO();
+
+    //The game runs on a thread of its own, so that it never waits for the window to be
+    //updated - the main thread owns the window, and presents the frames
+    SDL_Thread* game_thread = nullptr;
+
+    if (render::start_present_loop())
+    {
+        game_thread = SDL_CreateThread(run_game, "game", nullptr);
+    }
+
+    if (game_thread)
+    {
+        render::run_present_loop();
+
+        SDL_WaitThread(game_thread, nullptr);
+    }
+    else
+    {
+        TRACE << "Failed to start game thread, running the game on this thread" << endl;
+
+        render::stop_present_loop();
+
+        run_game(nullptr);
+    }
+
     init::cleanup_iO();
 
     TRACE_FUNC_END;
 
     return 0;
 }
-
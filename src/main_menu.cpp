@@ -32,6 +32,8 @@ string quote = "";
 
 string hpl_quote()
 {
+    rnd::Stream_scope rnd_scope(rnd::Stream::cosmetic);
+
     vector<string> quotes;
     quotes.clear();
     quotes.push_back(
@@ -215,6 +217,8 @@ void draw(const Menu_browser& browser)
 {
     TRACE_FUNC_BEGIN;
 
+    rnd::Stream_scope rnd_scope(rnd::Stream::cosmetic);
+
     Pos pos(MAP_W_HALF, 3);
 
     TRACE << "Calling clear_window()" << endl;
@@ -11,6 +11,7 @@
 #include "item.hpp"
 #include "utils.hpp"
 #include "feature_rigid.hpp"
+#include "fire_smoke.hpp"
 
 #ifdef DEMO_MODE
 #include "sdl_wrapper.hpp"
@@ -26,8 +27,7 @@ Cell::Cell() :
     player_los          (),
     item                (nullptr),
     rigid               (nullptr),
-    player_visual_memory(Cell_render_data()),
-    pos(Pos(-1, -1)) {}
+    pos                 (Pos(-1, -1)) {}
 
 Cell::~Cell()
 {
@@ -49,8 +49,6 @@ void Cell::reset()
     player_los.is_blocked_hard      = true;
     player_los.is_blocked_by_drk    = false;
 
-    player_visual_memory = Cell_render_data();
-
     pos.set(-1, -1);
 
     if (rigid)
@@ -69,19 +67,22 @@ void Cell::reset()
 namespace map
 {
 
-Player*         player  = nullptr;
-int             dlvl    = 0;
-Cell            cells[MAP_W][MAP_H];
-vector<Room*>   room_list;
-Room*           room_map[MAP_W][MAP_H];
+thread_local Player*         player  = nullptr;
+thread_local int             dlvl    = 0;
+thread_local Cell            cells[MAP_W][MAP_H];
+thread_local vector<Room*>   room_list;
+thread_local Room*           room_map[MAP_W][MAP_H];
+thread_local unsigned char   cell_traits[MAP_W][MAP_H];
 
-Clr             wall_clr;
+thread_local Clr             wall_clr;
 
 namespace
 {
 
 void reset_cells(const bool MAKE_STONE_WALLS)
 {
+    fire_smoke::reset();
+
     for (int x = 0; x < MAP_W; ++x)
     {
         for (int y = 0; y < MAP_H; ++y)
@@ -89,10 +90,12 @@ void reset_cells(const bool MAKE_STONE_WALLS)
             cells[x][y].reset();
             cells[x][y].pos = Pos(x, y);
 
-            room_map[x][y]   = nullptr;
+            room_map[x][y]      = nullptr;
+            cell_traits[x][y]   = 0;
 
             render::render_array[x][y]              = Cell_render_data();
             render::render_array_no_actors[x][y]    = Cell_render_data();
+            render::player_visual_memory[x][y]      = Cell_render_data();
 
             if (MAKE_STONE_WALLS)
             {
@@ -208,6 +211,8 @@ Rigid* put(Rigid* const f)
 
     cell.rigid = f;
 
+    update_cell_traits(p);
+
 #ifdef DEMO_MODE
 
     if (f->id() == Feature_id::floor)
@@ -231,20 +236,28 @@ Rigid* put(Rigid* const f)
     return f;
 }
 
+void update_cell_traits(const Pos& p)
+{
+    const Rigid* const rigid = cells[p.x][p.y].rigid;
+
+    cell_traits[p.x][p.y] =
+        (rigid && utils::is_pos_inside_map(p, false)) ? rigid->traits() : 0;
+}
+
 void cpy_render_array_to_visual_memory()
 {
-    for (int x = 0; x < MAP_W; ++x)
+    //Only the cells seen by the player can have changed since the last copy
+    for (const Pos& p : player->unmemorized_cells())
     {
-        for (int y = 0; y < MAP_H; ++y)
-        {
-            const Cell_render_data render_data = render::render_array_no_actors[x][y];
+        const Cell_render_data& render_data = render::render_array_no_actors[p.x][p.y];
 
-            assert(!render_data.is_aware_of_mon_here);
-            assert(!render_data.is_living_actor_seen_here);
+        assert(!render_data.is_aware_of_mon_here);
+        assert(!render_data.is_living_actor_seen_here);
 
-            cells[x][y].player_visual_memory = render_data;
-        }
+        render::player_visual_memory[p.x][p.y] = render_data;
     }
+
+    player->on_cells_memorized();
 }
 
 void mk_blood(const Pos& origin)
@@ -50,15 +50,10 @@ namespace
 {
 
 //All cells marked as true in this array will be considered for door placement
-bool door_proposals[MAP_W][MAP_H];
+thread_local bool door_proposals[MAP_W][MAP_H];
 
-bool is_all_rooms_connected()
-{
-    bool blocked[MAP_W][MAP_H];
-    map_parse::run(cell_check::Blocks_move_cmn(false), blocked);
-
-    return map_parse::is_map_connected(blocked);
-}
+//Stairs are placed on a random cell out of at least this many allowed cells
+const int MIN_NR_STAIR_CELLS = 3;
 
 //Adds the room to the room list and the room map
 void register_room(Room& room)
@@ -94,40 +89,117 @@ void mk_floor_in_room(const Room& room)
     }
 }
 
+bool is_std_room(const Room& r)
+{
+    return int(r.type_) < int(Room_type::END_OF_STD_ROOMS);
+}
+
+//Corridors are only carved between the corridor entries of standard rooms, and they never
+//run adjacent to free cells (see mk_path_find_cor()) - so a set of free cells which does
+//not border any corridor entry can never be connected to the rest of the map.
+bool is_any_free_set_unreachable(map_gen_utils::Free_cell_sets& free_cells)
+{
+    vector<int> reached_set_ids;
+    vector<Pos> entries;
+
+    for (Room* const room : map::room_list)
+    {
+        if (!is_std_room(*room))
+        {
+            continue;
+        }
+
+        map_gen_utils::valid_room_corr_entries(*room, entries);
+
+        for (const Pos& entry : entries)
+        {
+            for (const Pos& d : dir_utils::cardinal_list)
+            {
+                const Pos p(entry + d);
+
+                if (map::room_map[p.x][p.y] == room && free_cells.is_free(p))
+                {
+                    reached_set_ids.push_back(free_cells.set_id(p));
+                    break;
+                }
+            }
+        }
+    }
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            const Pos p(x, y);
+
+            if (!free_cells.is_free(p))
+            {
+                continue;
+            }
+
+            const int SET_ID = free_cells.set_id(p);
+
+            bool is_reached = false;
+
+            for (const int REACHED_ID : reached_set_ids)
+            {
+                if (free_cells.is_same_set(SET_ID, REACHED_ID))
+                {
+                    is_reached = true;
+                    break;
+                }
+            }
+
+            if (!is_reached)
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
 void connect_rooms()
 {
     TRACE_FUNC_BEGIN;
 
-    int nr_tries_left = 5000;
+    map_gen_utils::Free_cell_sets free_cells;
 
-    while (true)
+    //Making corridors for a map which can never be connected is a waste of time
+    if (!free_cells.is_all_connected() && is_any_free_set_unreachable(free_cells))
+    {
+        TRACE << "Free cells unreachable by corridors, discarding map" << endl;
+        map_gen::reject_map(Map_gen_reject::unreachable_rooms);
+        TRACE_FUNC_END;
+        return;
+    }
+
+    //First, random rooms are connected (this gives the levels their loops). The random
+    //corridors often fail, and the last few sets of rooms are hard to hit by chance, so
+    //this is only done for a limited number of corridors - any sets of rooms which are
+    //still unconnected after that are joined by the shortest corridors between them.
+    int nr_std_rooms = 0;
+
+    for (const Room* const room : map::room_list)
+    {
+        if (is_std_room(*room)) {++nr_std_rooms;}
+    }
+
+    int nr_tries_left   = 5000;
+    int nr_cors_left    = nr_std_rooms * 2;
+
+    while (nr_tries_left > 0 && nr_cors_left > 0)
     {
         //NOTE: Keep this counter at the top of the loop, since otherwise a "continue"
         //statement could bypass it so we get stuck in the loop.
         --nr_tries_left;
 
-        if (nr_tries_left == 0)
-        {
-            map_gen::is_map_valid = false;
-#ifdef DEMO_MODE
-            render::cover_panel(Panel::log);
-            render::draw_text("Failed to connect map", Panel::screen, {0, 0}, clr_red_lgt);
-            render::update_screen();
-            sdl_wrapper::sleep(8000);
-#endif // DEMO_MODE
-            break;
-        }
-
         auto rnd_room = []()
         {
             return map::room_list[rnd::range(0, map::room_list.size() - 1)];
         };
 
-        auto is_std_room = [](const Room & r)
-        {
-            return int(r.type_) < int(Room_type::END_OF_STD_ROOMS);
-        };
-
         Room* room0 = rnd_room();
 
         //Room 0 must be a standard room or corridor link
@@ -194,14 +266,27 @@ void connect_rooms()
             continue;
         }
 
-        map_gen_utils::mk_path_find_cor(*room0, *room1, door_proposals);
+        map_gen_utils::mk_path_find_cor(*room0, *room1, door_proposals, &free_cells);
+
+        --nr_cors_left;
 
-        if ((nr_tries_left <= 2 || rnd::one_in(4)) && is_all_rooms_connected())
+        if (rnd::one_in(4) && free_cells.is_all_connected())
         {
             break;
         }
     }
 
+    if (!map_gen_utils::mk_cors_to_unconnected_rooms(free_cells, door_proposals))
+    {
+        map_gen::reject_map(Map_gen_reject::rooms_not_connected);
+#ifdef DEMO_MODE
+        render::cover_panel(Panel::log);
+        render::draw_text("Failed to connect map", Panel::screen, {0, 0}, clr_red_lgt);
+        render::update_screen();
+        sdl_wrapper::sleep(8000);
+#endif // DEMO_MODE
+    }
+
     TRACE_FUNC_END;
 }
 
@@ -990,14 +1075,44 @@ void decorate()
     }
 }
 
-void allowed_stair_cells(bool out[MAP_W][MAP_H])
+//Marks cells as free if all adjacent feature types are allowed for stairs
+void stair_feature_cells(bool out[MAP_W][MAP_H])
 {
-    TRACE_FUNC_BEGIN;
-
-    //Mark cells as free if all adjacent feature types are allowed
     vector<Feature_id> feat_ids_ok {Feature_id::floor, Feature_id::carpet, Feature_id::grass};
 
     map_parse::run(cell_check::All_adj_is_any_of_features(feat_ids_ok), out);
+}
+
+//None of the steps after post-connect (doors, decoration, populating) can add any cells
+//allowed for the stairs, they can only block them. So if there are already too few cells,
+//there is no need to finish the map before discarding it.
+bool has_enough_stair_cells()
+{
+    bool feature_cells[MAP_W][MAP_H];
+    stair_feature_cells(feature_cells);
+
+    int nr_cells = 0;
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            if (feature_cells[x][y])
+            {
+                ++nr_cells;
+            }
+        }
+    }
+
+    //One of the cells will be occupied by the player
+    return nr_cells >= MIN_NR_STAIR_CELLS + 1;
+}
+
+void allowed_stair_cells(bool out[MAP_W][MAP_H])
+{
+    TRACE_FUNC_BEGIN;
+
+    stair_feature_cells(out);
 
     //Block cells with item
     for (int x = 0; x < MAP_W; ++x)
@@ -1033,13 +1148,11 @@ Pos place_stairs()
 
     const int NR_OK_CELLS = allowed_cells_list.size();
 
-    const int MIN_NR_OK_CELLS_REQ = 3;
-
-    if (NR_OK_CELLS < MIN_NR_OK_CELLS_REQ)
+    if (NR_OK_CELLS < MIN_NR_STAIR_CELLS)
     {
         TRACE << "Nr available cells to place stairs too low "
               << "(" << NR_OK_CELLS << "), discarding map" << endl;
-        is_map_valid = false;
+        reject_map(Map_gen_reject::too_few_stair_cells);
 #ifdef DEMO_MODE
         render::cover_panel(Panel::log);
         render::draw_map();
@@ -1078,7 +1191,7 @@ void move_player_to_nearest_allowed_pos()
 
     if (allowed_cells_list.empty())
     {
-        is_map_valid = false;
+        reject_map(Map_gen_reject::no_player_cell);
     }
     else
     {
@@ -1204,23 +1317,29 @@ bool mk_std_lvl()
 
     is_map_valid = true;
 
+    map_gen_stats::on_attempt_begin();
+
     render::clear_screen();
     render::update_screen();
 
-    map::reset_map();
+    {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::reset);
 
-    TRACE << "Resetting helper arrays" << endl;
+        map::reset_map();
 
-    for (int x = 0; x < MAP_W; ++x)
-    {
-        for (int y = 0; y < MAP_H; ++y)
+        TRACE << "Resetting helper arrays" << endl;
+
+        for (int x = 0; x < MAP_W; ++x)
         {
-            door_proposals[x][y] = false;
+            for (int y = 0; y < MAP_H; ++y)
+            {
+                door_proposals[x][y] = false;
+            }
         }
-    }
 
-    //NOTE: This must be called before any rooms are created
-    room_factory::init_room_bucket();
+        //NOTE: This must be called before any rooms are created
+        room_factory::init_room_bucket();
+    }
 
     TRACE << "Init regions" << endl;
     const int MAP_W_THIRD = MAP_W / 3;
@@ -1250,6 +1369,8 @@ bool mk_std_lvl()
 
     if (is_map_valid && map::dlvl >= DLVL_FIRST_MID_GAME && rnd::one_in(RIVER_ONE_IN_N))
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::river);
+
         reserve_river(regions);
     }
 #endif // MK_RIVER
@@ -1257,6 +1378,8 @@ bool mk_std_lvl()
 #ifdef MK_MERGED_REGIONS
     if (is_map_valid)
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::merged_regions);
+
         mk_merged_regions_and_rooms(regions);
     }
 #endif // MK_MERGED_REGIONS
@@ -1264,6 +1387,8 @@ bool mk_std_lvl()
 #ifdef RANDOMLY_BLOCK_REGIONS
     if (is_map_valid)
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::blocked_regions);
+
         randomly_block_regions(regions);
     }
 #endif // RANDOMLY_BLOCK_REGIONS
@@ -1272,6 +1397,8 @@ bool mk_std_lvl()
     {
         TRACE << "Making main rooms" << endl;
 
+        map_gen_stats::Stage_timer timer(Map_gen_stage::main_rooms);
+
         for (int x = 0; x < 3; ++x)
         {
             for (int y = 0; y < 3; ++y)
@@ -1302,6 +1429,8 @@ bool mk_std_lvl()
 #endif // DEMO_MODE
     if (is_map_valid)
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::aux_rooms);
+
         mk_aux_rooms(regions);
     }
 #endif // MK_AUX_ROOMS
@@ -1317,6 +1446,8 @@ bool mk_std_lvl()
         render::update_screen();
         query::wait_for_key_press();
 #endif // DEMO_MODE
+        map_gen_stats::Stage_timer timer(Map_gen_stage::sub_rooms);
+
         mk_sub_rooms();
     }
 #endif // MK_SUB_ROOMS
@@ -1346,6 +1477,8 @@ bool mk_std_lvl()
         query::wait_for_key_press();
 #endif // DEMO_MODE
 
+        map_gen_stats::Stage_timer timer(Map_gen_stage::pre_connect);
+
         gods::set_no_god();
 
         for (Room* room : map::room_list)
@@ -1365,6 +1498,8 @@ bool mk_std_lvl()
         render::update_screen();
         query::wait_for_key_press();
 #endif // DEMO_MODE
+        map_gen_stats::Stage_timer timer(Map_gen_stage::connect);
+
         connect_rooms();
     }
 
@@ -1381,12 +1516,20 @@ bool mk_std_lvl()
         query::wait_for_key_press();
 #endif // DEMO_MODE
 
+        map_gen_stats::Stage_timer timer(Map_gen_stage::post_connect);
+
         for (Room* room : map::room_list)
         {
             room->on_post_connect(door_proposals);
         }
     }
 
+    if (is_map_valid && !has_enough_stair_cells())
+    {
+        TRACE << "Too few free cells left for the stairs, discarding map" << endl;
+        reject_map(Map_gen_reject::too_few_free_cells);
+    }
+
 #ifdef FILL_DEAD_ENDS
     if (is_map_valid)
     {
@@ -1398,6 +1541,8 @@ bool mk_std_lvl()
         render::update_screen();
         query::wait_for_key_press();
 #endif // DEMO_MODE
+        map_gen_stats::Stage_timer timer(Map_gen_stage::dead_ends);
+
         fill_dead_ends();
     }
 #endif // FILL_DEAD_ENDS
@@ -1406,6 +1551,8 @@ bool mk_std_lvl()
     {
         TRACE << "Placing doors" << endl;
 
+        map_gen_stats::Stage_timer timer(Map_gen_stage::doors);
+
         for (int x = 0; x < MAP_W; ++x)
         {
             for (int y = 0; y < MAP_H; ++y)
@@ -1420,28 +1567,38 @@ bool mk_std_lvl()
 
     if (is_map_valid)
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::player_pos);
+
         move_player_to_nearest_allowed_pos();
     }
 
 #ifdef DECORATE
     if (is_map_valid)
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::decorate);
+
         decorate();
     }
 #endif // DECORATE
 
     if (is_map_valid)
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::populate_mon);
+
         populate_mon::populate_std_lvl();
     }
 
     if (is_map_valid)
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::populate_traps);
+
         populate_traps::populate_std_lvl();
     }
 
     if (is_map_valid)
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::populate_items);
+
         populate_items::mk_items_on_floor();
     }
 
@@ -1449,6 +1606,8 @@ bool mk_std_lvl()
 
     if (is_map_valid)
     {
+        map_gen_stats::Stage_timer timer(Map_gen_stage::stairs);
+
         stairs_pos = place_stairs();
     }
 
@@ -1456,6 +1615,8 @@ bool mk_std_lvl()
     {
         const int LAST_LVL_TO_REVEAL_STAIRS_PATH = 9;
 
+        map_gen_stats::Stage_timer timer(Map_gen_stage::reveal_path);
+
         if (map::dlvl <= LAST_LVL_TO_REVEAL_STAIRS_PATH)
         {
             reveal_doors_on_path_to_stairs(stairs_pos);
@@ -1470,6 +1631,8 @@ bool mk_std_lvl()
     map::room_list.clear();
     utils::reset_array(map::room_map);
 
+    map_gen_stats::on_attempt_end(is_map_valid);
+
     TRACE_FUNC_END;
     return is_map_valid;
 }
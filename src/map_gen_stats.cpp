@@ -0,0 +1,221 @@
+#include "map_gen_stats.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+namespace map_gen_stats
+{
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+struct Reject_stats
+{
+    long long   nr;
+    double      tot_us;     //Time spent on the rejected attempts
+};
+
+thread_local Stage_stats        stages_[int(Map_gen_stage::END)];
+thread_local Reject_stats       rejects_[int(Map_gen_reject::END)];
+
+thread_local long long          nr_attempts_    = 0;
+thread_local long long          nr_valid_       = 0;
+thread_local double             valid_us_       = 0.0;
+
+thread_local Clock::time_point  attempt_start_;
+thread_local Map_gen_reject     attempt_reject_ = Map_gen_reject::END;
+
+} //namespace
+
+void reset()
+{
+    for (Stage_stats& s : stages_)
+    {
+        s = {0, 0.0, 0.0};
+    }
+
+    for (Reject_stats& r : rejects_)
+    {
+        r = {0, 0.0};
+    }
+
+    nr_attempts_    = 0;
+    nr_valid_       = 0;
+    valid_us_       = 0.0;
+}
+
+void on_attempt_begin()
+{
+    ++nr_attempts_;
+
+    attempt_start_  = Clock::now();
+    attempt_reject_ = Map_gen_reject::END;
+}
+
+void on_attempt_end(const bool IS_VALID)
+{
+    const double US = std::chrono::duration<double, std::micro>(Clock::now() -
+                                                                attempt_start_).count();
+
+    if (IS_VALID)
+    {
+        ++nr_valid_;
+        valid_us_ += US;
+    }
+    else if (attempt_reject_ != Map_gen_reject::END)
+    {
+        rejects_[int(attempt_reject_)].tot_us += US;
+    }
+}
+
+void on_stage_done(const Map_gen_stage stage, const double US)
+{
+    assert(stage != Map_gen_stage::END);
+
+    Stage_stats& s = stages_[int(stage)];
+
+    ++s.nr_runs;
+
+    s.tot_us += US;
+    s.max_us  = std::max(s.max_us, US);
+}
+
+void on_reject(const Map_gen_reject reason)
+{
+    assert(reason != Map_gen_reject::END);
+
+    ++rejects_[int(reason)].nr;
+
+    //Only the first reason is counted for the time of the attempt
+    if (attempt_reject_ == Map_gen_reject::END)
+    {
+        attempt_reject_ = reason;
+    }
+}
+
+long long nr_attempts()
+{
+    return nr_attempts_;
+}
+
+long long nr_valid()
+{
+    return nr_valid_;
+}
+
+long long nr_rejects(const Map_gen_reject reason)
+{
+    assert(reason != Map_gen_reject::END);
+
+    return rejects_[int(reason)].nr;
+}
+
+const Stage_stats& stage_stats(const Map_gen_stage stage)
+{
+    assert(stage != Map_gen_stage::END);
+
+    return stages_[int(stage)];
+}
+
+const char* stage_name(const Map_gen_stage stage)
+{
+    switch (stage)
+    {
+    case Map_gen_stage::reset:              return "reset";
+    case Map_gen_stage::river:              return "river";
+    case Map_gen_stage::merged_regions:     return "merged_regions";
+    case Map_gen_stage::blocked_regions:    return "blocked_regions";
+    case Map_gen_stage::main_rooms:         return "main_rooms";
+    case Map_gen_stage::aux_rooms:          return "aux_rooms";
+    case Map_gen_stage::sub_rooms:          return "sub_rooms";
+    case Map_gen_stage::pre_connect:        return "pre_connect";
+    case Map_gen_stage::connect:            return "connect";
+    case Map_gen_stage::post_connect:       return "post_connect";
+    case Map_gen_stage::dead_ends:          return "dead_ends";
+    case Map_gen_stage::doors:              return "doors";
+    case Map_gen_stage::player_pos:         return "player_pos";
+    case Map_gen_stage::decorate:           return "decorate";
+    case Map_gen_stage::populate_mon:       return "populate_mon";
+    case Map_gen_stage::populate_traps:     return "populate_traps";
+    case Map_gen_stage::populate_items:     return "populate_items";
+    case Map_gen_stage::stairs:             return "stairs";
+    case Map_gen_stage::reveal_path:        return "reveal_path";
+    case Map_gen_stage::END:                break;
+    }
+
+    assert(false);
+
+    return "";
+}
+
+const char* reject_name(const Map_gen_reject reason)
+{
+    switch (reason)
+    {
+    case Map_gen_reject::river_not_bridged:     return "river_not_bridged";
+    case Map_gen_reject::unreachable_rooms:     return "unreachable_rooms";
+    case Map_gen_reject::rooms_not_connected:   return "rooms_not_connected";
+    case Map_gen_reject::too_few_free_cells:    return "too_few_free_cells";
+    case Map_gen_reject::no_player_cell:        return "no_player_cell";
+    case Map_gen_reject::too_few_stair_cells:   return "too_few_stair_cells";
+    case Map_gen_reject::END:                   break;
+    }
+
+    assert(false);
+
+    return "";
+}
+
+void print_report(FILE* const f)
+{
+    const long long NR_REJECTED = nr_attempts_ - nr_valid_;
+
+    double rejected_us = 0.0;
+
+    for (const Reject_stats& r : rejects_)
+    {
+        rejected_us += r.tot_us;
+    }
+
+    fprintf(f, "    %lld attempts, %lld valid, %lld rejected\n",
+            nr_attempts_, nr_valid_, NR_REJECTED);
+
+    fprintf(f, "    %.1f ms on valid levels, %.1f ms on rejected levels\n",
+            valid_us_ / 1000.0, rejected_us / 1000.0);
+
+    fprintf(f, "    %-20s %10s %12s %12s %12s\n",
+            "stage", "runs", "total (ms)", "mean (us)", "max (us)");
+
+    for (int i = 0; i < int(Map_gen_stage::END); ++i)
+    {
+        const Stage_stats& s = stages_[i];
+
+        if (s.nr_runs == 0)
+        {
+            continue;
+        }
+
+        fprintf(f, "    %-20s %10lld %12.2f %12.1f %12.1f\n",
+                stage_name(Map_gen_stage(i)), s.nr_runs, s.tot_us / 1000.0,
+                s.tot_us / s.nr_runs, s.max_us);
+    }
+
+    fprintf(f, "    %-20s %10s %12s\n", "rejected by", "count", "total (ms)");
+
+    for (int i = 0; i < int(Map_gen_reject::END); ++i)
+    {
+        const Reject_stats& r = rejects_[i];
+
+        if (r.nr == 0)
+        {
+            continue;
+        }
+
+        fprintf(f, "    %-20s %10lld %12.2f\n",
+                reject_name(Map_gen_reject(i)), r.nr, r.tot_us / 1000.0);
+    }
+}
+
+} //map_gen_stats
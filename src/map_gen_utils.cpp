@@ -4,6 +4,9 @@
 
 #include <vector>
 #include <cassert>
+#include <climits>
+#include <queue>
+#include <algorithm>
 
 #include "map.hpp"
 #include "map_parsing.hpp"
@@ -16,7 +19,16 @@ using namespace std;
 namespace map_gen
 {
 
-bool is_map_valid = true;
+thread_local bool is_map_valid = true;
+
+void reject_map(const Map_gen_reject reason)
+{
+    TRACE << "Map rejected: " << map_gen_stats::reject_name(reason) << endl;
+
+    is_map_valid = false;
+
+    map_gen_stats::on_reject(reason);
+}
 
 }
 
@@ -26,7 +38,7 @@ namespace map_gen_utils
 namespace
 {
 
-Feature_id backup[MAP_W][MAP_H];
+thread_local Feature_id backup[MAP_W][MAP_H];
 
 void floor_cells_in_room(const Room& room, const bool floor[MAP_W][MAP_H],
                          vector<Pos>& out)
@@ -42,8 +54,418 @@ void floor_cells_in_room(const Room& room, const bool floor[MAP_W][MAP_H],
     }
 }
 
+//Corridors may only be made in wall cells which are not part of a room, and which are not
+//adjacent to a room or a free cell (except for at the corridor entries)
+void mk_cor_blocked(bool out[MAP_W][MAP_H])
+{
+    bool blocked[MAP_W][MAP_H];
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            blocked[x][y] = map::room_map[x][y] ||
+                            map::cells[x][y].rigid->id() != Feature_id::wall;
+        }
+    }
+
+    map_parse::expand(blocked, out);
+}
+
+//Carves a corridor along the path - the first and last positions of the path should be
+//the corridor entries of the two rooms
+void mk_cor(const vector<Pos>& path, Room& r0, Room& r1,
+            const bool blocked_expanded[MAP_W][MAP_H],
+            bool door_proposals[MAP_W][MAP_H],
+            Free_cell_sets* const free_cells)
+{
+    assert(!path.empty());
+
+    auto put_floor = [free_cells](const Pos & p)
+    {
+        map::put(new Floor(p));
+
+        if (free_cells) {free_cells->on_cell_freed(p);}
+    };
+
+    vector<Room*> prev_links;
+
+    for (size_t i = 0; i < path.size(); ++i)
+    {
+        const Pos& p(path[i]);
+
+        //If this is a late game level, put floor in 3x3 cells around each point in
+        //the path (wide corridors for more "open" level).
+        if (map::dlvl >= DLVL_FIRST_LATE_GAME && rnd::fraction(4, 5))
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                for (int dy = -1; dy <= 1; ++dy)
+                {
+                    const Pos p_adj(p + Pos(dx, dy));
+
+                    if (
+                        utils::is_pos_inside_map(p_adj, false) &&
+                        !blocked_expanded[p_adj.x][p_adj.y])
+                    {
+                        put_floor(p_adj);
+                    }
+                }
+            }
+        }
+
+        put_floor(p);
+
+        if (i > 1 && int(i) < int(path.size() - 3) && i % 6 == 0)
+        {
+            Room* link = room_factory::mk(Room_type::corr_link, Rect(p, p));
+            map::room_list.push_back(link);
+            map::room_map[p.x][p.y] = link;
+            link->rooms_con_to_.push_back(&r0);
+            link->rooms_con_to_.push_back(&r1);
+            r0.rooms_con_to_.push_back(link);
+            r1.rooms_con_to_.push_back(link);
+
+            for (Room* prev_link : prev_links)
+            {
+                link->rooms_con_to_.push_back(prev_link);
+                prev_link->rooms_con_to_.push_back(link);
+            }
+
+            prev_links.push_back(link);
+        }
+    }
+
+    if (door_proposals)
+    {
+        const Pos& p0 = path.front();
+        const Pos& p1 = path.back();
+
+        door_proposals[p0.x][p0.y] = door_proposals[p1.x][p1.y] = true;
+    }
+
+    r0.rooms_con_to_.push_back(&r1);
+    r1.rooms_con_to_.push_back(&r0);
+}
+
+int cell_idx(const Pos& p)
+{
+    return p.x * MAP_H + p.y;
+}
+
+//Computes a single weighted distance field from the corridor entries of all standard rooms,
+//and carves the cheapest corridor between two sets of free cells, where their regions meet.
+//Returns false if no such corridor was found.
+bool mk_cheapest_cor_between_sets(Free_cell_sets& free_cells,
+                                  bool door_proposals[MAP_W][MAP_H])
+{
+    //The corridor which would join two sets, meeting between p0 and p1
+    struct Edge
+    {
+        int     cost;
+        Pos     p0, p1;
+        Room*   r0;
+        Room*   r1;
+        int     set0, set1;
+
+        bool operator<(const Edge& other) const
+        {
+            return cost < other.cost;
+        }
+    };
+
+    bool blocked[MAP_W][MAP_H];
+    mk_cor_blocked(blocked);
+
+    //Each reached cell stores its distance to the closest corridor entry, the step back
+    //towards that entry, and the room and set of the entry
+    int     dist[MAP_W][MAP_H];
+    Pos     parent[MAP_W][MAP_H];
+    Room*   room_at[MAP_W][MAP_H];
+    int     set_at[MAP_W][MAP_H];
+
+    std::fill_n(*dist, MAP_W * MAP_H, INT_MAX);
+    utils::reset_array(room_at);
+
+    typedef pair<int, int> Dist_and_cell;
+
+    priority_queue< Dist_and_cell, vector<Dist_and_cell>, greater<Dist_and_cell> > q;
+
+    //Only the cheapest edge between each pair of sets is kept (there are few sets)
+    vector<Edge> edges;
+
+    auto add_edge = [&edges](const Edge & e)
+    {
+        for (Edge& other : edges)
+        {
+            if (
+                (other.set0 == e.set0 && other.set1 == e.set1) ||
+                (other.set0 == e.set1 && other.set1 == e.set0))
+            {
+                if (e.cost < other.cost) {other = e;}
+
+                return;
+            }
+        }
+
+        edges.push_back(e);
+    };
+
+    vector<Pos> entries;
+
+    for (Room* const room : map::room_list)
+    {
+        if (int(room->type_) >= int(Room_type::END_OF_STD_ROOMS))
+        {
+            continue;
+        }
+
+        valid_room_corr_entries(*room, entries);
+
+        for (const Pos& p : entries)
+        {
+            //The set of the room floor next to the entry
+            int set_id = -1;
+
+            for (const Pos& d : dir_utils::cardinal_list)
+            {
+                const Pos p_adj(p + d);
+
+                if (map::room_map[p_adj.x][p_adj.y] == room && free_cells.is_free(p_adj))
+                {
+                    set_id = free_cells.set_id(p_adj);
+                    break;
+                }
+            }
+
+            if (set_id < 0)
+            {
+                continue;
+            }
+
+            if (room_at[p.x][p.y])
+            {
+                //The entry is shared with another room - if that room is in another set,
+                //they can be joined by just opening the entry
+                if (set_at[p.x][p.y] != set_id)
+                {
+                    add_edge({0, p, p, room_at[p.x][p.y], room, set_at[p.x][p.y], set_id});
+                }
+
+                continue;
+            }
+
+            dist[p.x][p.y]      = 0;
+            parent[p.x][p.y]    = p;
+            room_at[p.x][p.y]   = room;
+            set_at[p.x][p.y]    = set_id;
+            blocked[p.x][p.y]   = false;
+
+            q.push(Dist_and_cell(0, p.x * MAP_H + p.y));
+        }
+    }
+
+    //Allowing diagonal steps makes a more "cave like" path
+    const bool ALLOW_DIAGONAL = map::dlvl >= DLVL_FIRST_LATE_GAME;
+
+    const vector<Pos>& dirs = ALLOW_DIAGONAL ? dir_utils::dir_list : dir_utils::cardinal_list;
+
+    auto step_cost = [](const Pos & d)
+    {
+        return (d.x == 0 || d.y == 0) ? 2 : 3;
+    };
+
+    //All corridor entries are expanded at once, so each cell is claimed by the closest entry
+    while (!q.empty())
+    {
+        const Dist_and_cell cur = q.top();
+        q.pop();
+
+        const Pos p(cur.second / MAP_H, cur.second % MAP_H);
+
+        if (cur.first > dist[p.x][p.y])
+        {
+            continue;
+        }
+
+        for (const Pos& d : dirs)
+        {
+            const Pos p_adj(p + d);
+
+            if (!utils::is_pos_inside_map(p_adj, false) || blocked[p_adj.x][p_adj.y])
+            {
+                continue;
+            }
+
+            const int NEW_DIST = cur.first + step_cost(d);
+
+            if (NEW_DIST < dist[p_adj.x][p_adj.y])
+            {
+                dist[p_adj.x][p_adj.y]      = NEW_DIST;
+                parent[p_adj.x][p_adj.y]    = p;
+                room_at[p_adj.x][p_adj.y]   = room_at[p.x][p.y];
+                set_at[p_adj.x][p_adj.y]    = set_at[p.x][p.y];
+
+                q.push(Dist_and_cell(NEW_DIST, p_adj.x * MAP_H + p_adj.y));
+            }
+        }
+    }
+
+    //The other corridor entries should not be opened up by wide corridors
+    mk_cor_blocked(blocked);
+
+    //Find the cheapest meeting point between each pair of sets
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            if (dist[x][y] == INT_MAX)
+            {
+                continue;
+            }
+
+            const Pos p(x, y);
+
+            for (const Pos& d : dirs)
+            {
+                const Pos p_adj(p + d);
+
+                if (
+                    !utils::is_pos_inside_map(p_adj, false) ||
+                    dist[p_adj.x][p_adj.y] == INT_MAX       ||
+                    set_at[p_adj.x][p_adj.y] == set_at[x][y])
+                {
+                    continue;
+                }
+
+                const int COST = dist[x][y] + step_cost(d) + dist[p_adj.x][p_adj.y];
+
+                const int SET_0 = set_at[x][y];
+                const int SET_1 = set_at[p_adj.x][p_adj.y];
+
+                add_edge({COST, p, p_adj, room_at[x][y], room_at[p_adj.x][p_adj.y],
+                          SET_0, SET_1
+                         });
+            }
+        }
+    }
+
+    TRACE_VERBOSE << "Nr candidate corridors: " << edges.size() << endl;
+
+    if (edges.empty())
+    {
+        return false;
+    }
+
+    const Edge& e = *min_element(edges.begin(), edges.end());
+
+    //Entry of room 0 -> p0
+    vector<Pos> path;
+
+    for (Pos p = e.p0; ; p = parent[p.x][p.y])
+    {
+        path.push_back(p);
+
+        if (parent[p.x][p.y] == p) {break;}
+    }
+
+    reverse(path.begin(), path.end());
+
+    //p1 -> entry of room 1
+    if (e.p1 != e.p0)
+    {
+        for (Pos p = e.p1; ; p = parent[p.x][p.y])
+        {
+            path.push_back(p);
+
+            if (parent[p.x][p.y] == p) {break;}
+        }
+    }
+
+    mk_cor(path, *e.r0, *e.r1, blocked, door_proposals, &free_cells);
+
+    return free_cells.is_same_set(e.set0, e.set1);
+}
+
 } //namespace
 
+//=============================================================== FREE CELL SETS
+Free_cell_sets::Free_cell_sets() :
+    sets_       (MAP_W * MAP_H),
+    nr_sets_    (0)
+{
+    const cell_check::Blocks_move_cmn blocks_move(false);
+
+    //Each free cell is merged with the free neighbours scanned before it (one pass)
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            is_free_[x][y] = !blocks_move.check(map::cells[x][y]);
+
+            if (!is_free_[x][y])
+            {
+                continue;
+            }
+
+            ++nr_sets_;
+
+            const Pos p(x, y);
+            const Pos prev_neighbours[] = {Pos(x - 1, y - 1), Pos(x - 1, y),
+                                           Pos(x - 1, y + 1), Pos(x, y - 1)
+                                          };
+
+            for (const Pos& p_adj : prev_neighbours)
+            {
+                if (
+                    utils::is_pos_inside_map(p_adj)             &&
+                    is_free_[p_adj.x][p_adj.y]                  &&
+                    sets_.unite(cell_idx(p), cell_idx(p_adj)))
+                {
+                    --nr_sets_;
+                }
+            }
+        }
+    }
+}
+
+void Free_cell_sets::on_cell_freed(const Pos& p)
+{
+    if (is_free_[p.x][p.y])
+    {
+        return;
+    }
+
+    is_free_[p.x][p.y] = true;
+
+    ++nr_sets_;
+
+    for (const Pos& d : dir_utils::dir_list)
+    {
+        const Pos p_adj(p + d);
+
+        if (
+            utils::is_pos_inside_map(p_adj)             &&
+            is_free_[p_adj.x][p_adj.y]                  &&
+            sets_.unite(cell_idx(p), cell_idx(p_adj)))
+        {
+            --nr_sets_;
+        }
+    }
+}
+
+int Free_cell_sets::set_id(const Pos& p)
+{
+    assert(is_free_[p.x][p.y]);
+
+    return sets_.find(cell_idx(p));
+}
+
+bool Free_cell_sets::is_same_set(const int SET_ID_0, const int SET_ID_1)
+{
+    return sets_.is_same_set(SET_ID_0, SET_ID_1);
+}
+
 void cut_room_corners(const Room& room)
 {
     if (!room.sub_rooms_.empty() || room.r_.min_dim() < 6)
@@ -323,7 +745,8 @@ void valid_room_corr_entries(const Room& room, vector<Pos>& out)
     TRACE_FUNC_END_VERBOSE;
 }
 
-void mk_path_find_cor(Room& r0, Room& r1, bool door_proposals[MAP_W][MAP_H])
+void mk_path_find_cor(Room& r0, Room& r1, bool door_proposals[MAP_W][MAP_H],
+                      Free_cell_sets* const free_cells)
 {
     TRACE_FUNC_BEGIN_VERBOSE << "Making corridor between rooms "
                              << &r0 << " and " << &r1 << endl;
@@ -387,6 +810,7 @@ void mk_path_find_cor(Room& r0, Room& r1, bool door_proposals[MAP_W][MAP_H])
 
     vector<Pos> path;
     bool blocked_expanded[MAP_W][MAP_H];
+    mk_cor_blocked(blocked_expanded);
 
     //Is entry points same cell (rooms are adjacent)? Then simply use that
     if (p0 == p1)
@@ -396,20 +820,6 @@ void mk_path_find_cor(Room& r0, Room& r1, bool door_proposals[MAP_W][MAP_H])
     else
     {
         //Else, try to find a path to the other entry point
-        bool blocked[MAP_W][MAP_H];
-        utils::reset_array(blocked, false);
-
-        for (int x = 0; x < MAP_W; ++x)
-        {
-            for (int y = 0; y < MAP_H; ++y)
-            {
-                blocked[x][y] = map::room_map[x][y] ||
-                                map::cells[x][y].rigid->id() != Feature_id::wall;
-            }
-        }
-
-        map_parse::expand(blocked, blocked_expanded);
-
         blocked_expanded[p0.x][p0.y] = blocked_expanded[p1.x][p1.y] = false;
 
         //Allowing diagonal steps makes a more "cave like" path
@@ -456,66 +866,35 @@ void mk_path_find_cor(Room& r0, Room& r1, bool door_proposals[MAP_W][MAP_H])
             }
         }
 
-        vector<Room*> prev_links;
-
-        for (size_t i = 0; i < path.size(); ++i)
-        {
-            const Pos& p(path[i]);
-
-            //If this is a late game level, put floor in 3x3 cells around each point in
-            //the path (wide corridors for more "open" level).
-            if (map::dlvl >= DLVL_FIRST_LATE_GAME && rnd::fraction(4, 5))
-            {
-                for (int dx = -1; dx <= 1; ++dx)
-                {
-                    for (int dy = -1; dy <= 1; ++dy)
-                    {
-                        const Pos p_adj(p + Pos(dx, dy));
-
-                        if (
-                            utils::is_pos_inside_map(p_adj, false) &&
-                            !blocked_expanded[p_adj.x][p_adj.y])
-                        {
-                            map::put(new Floor(p_adj));
-                        }
-                    }
-                }
-            }
+        mk_cor(path, r0, r1, blocked_expanded, door_proposals, free_cells);
 
-            map::put(new Floor(p));
+        TRACE_FUNC_END_VERBOSE << "Successfully connected roooms" << endl;
+        return;
+    }
 
-            if (i > 1 && int(i) < int(path.size() - 3) && i % 6 == 0)
-            {
-                Room* link = room_factory::mk(Room_type::corr_link, Rect(p, p));
-                map::room_list.push_back(link);
-                map::room_map[p.x][p.y] = link;
-                link->rooms_con_to_.push_back(&r0);
-                link->rooms_con_to_.push_back(&r1);
-                r0.rooms_con_to_.push_back(link);
-                r1.rooms_con_to_.push_back(link);
-
-                for (Room* prev_link : prev_links)
-                {
-                    link->rooms_con_to_.push_back(prev_link);
-                    prev_link->rooms_con_to_.push_back(link);
-                }
+    TRACE_FUNC_END_VERBOSE << "Failed to connect roooms" << endl;
+}
 
-                prev_links.push_back(link);
-            }
-        }
+bool mk_cors_to_unconnected_rooms(Free_cell_sets& free_cells,
+                                  bool door_proposals[MAP_W][MAP_H])
+{
+    TRACE_FUNC_BEGIN;
 
-        if (door_proposals)
+    //The distance field is made again after each corridor, so that the following corridors
+    //keep their distance to the previous ones (like to any other free cells)
+    while (!free_cells.is_all_connected())
+    {
+        if (!mk_cheapest_cor_between_sets(free_cells, door_proposals))
         {
-            door_proposals[p0.x][p0.y] = door_proposals[p1.x][p1.y] = true;
+            break;
         }
-
-        r0.rooms_con_to_.push_back(&r1);
-        r1.rooms_con_to_.push_back(&r0);
-        TRACE_FUNC_END_VERBOSE << "Successfully connected roooms" << endl;
-        return;
     }
 
-    TRACE_FUNC_END_VERBOSE << "Failed to connect roooms" << endl;
+    const bool IS_CONNECTED = free_cells.is_all_connected();
+
+    TRACE_FUNC_END << "Connected: " << IS_CONNECTED << endl;
+
+    return IS_CONNECTED;
 }
 
 void backup_map()
@@ -2,6 +2,7 @@
 
 #include <cassert>
 #include <algorithm>
+#include <climits>
 
 #include "map.hpp"
 #include "actor_player.hpp"
@@ -9,6 +10,9 @@
 #include "utils.hpp"
 #include "feature_rigid.hpp"
 #include "feature_mob.hpp"
+#include "fire_smoke.hpp"
+#include "profiler.hpp"
+#include "union_find.hpp"
 
 //------------------------------------------------------------ CELL CHECKS
 namespace cell_check
@@ -16,7 +20,10 @@ namespace cell_check
 
 bool Blocks_los::check(const Cell& c)  const
 {
-    return !utils::is_pos_inside_map(c.pos, false) || !c.rigid->is_los_passable();
+    const Pos p(c.pos);
+
+    return !(map::cell_traits[p.x][p.y] & feature_trait::is_los_passable) ||
+           fire_smoke::is_smoke_at(p);
 }
 
 bool Blocks_los::check(const Mob& f) const
@@ -26,7 +33,9 @@ bool Blocks_los::check(const Mob& f) const
 
 bool Blocks_move_cmn::check(const Cell& c) const
 {
-    return !utils::is_pos_inside_map(c.pos, false) || !c.rigid->can_move_cmn();
+    const Pos p(c.pos);
+
+    return !(map::cell_traits[p.x][p.y] & feature_trait::can_move_cmn);
 }
 
 bool Blocks_move_cmn::check(const Mob& f) const
@@ -56,7 +65,9 @@ bool Blocks_actor::check(const Actor& a) const
 
 bool Blocks_projectiles::check(const Cell& c)  const
 {
-    return !utils::is_pos_inside_map(c.pos, false) || !c.rigid->is_projectile_passable();
+    const Pos p(c.pos);
+
+    return !(map::cell_traits[p.x][p.y] & feature_trait::is_projectile_passable);
 }
 
 bool Blocks_projectiles::check(const Mob& f)  const
@@ -76,7 +87,9 @@ bool Living_actors_adj_to_pos::check(const Actor& a) const
 
 bool Blocks_items::check(const Cell& c)  const
 {
-    return !utils::is_pos_inside_map(c.pos, false) || !c.rigid->can_have_item();
+    const Pos p(c.pos);
+
+    return !(map::cell_traits[p.x][p.y] & feature_trait::can_have_item);
 }
 
 bool Blocks_items::check(const Mob& f) const
@@ -104,10 +117,11 @@ bool Is_any_of_features::check(const Cell& c) const
 
 bool All_adj_is_feature::check(const Cell& c) const
 {
-    const int X = c.pos.x;
-    const int Y = c.pos.y;
+    const Pos p = c.pos;
+    const int X = p.x;
+    const int Y = p.y;
 
-    if (!utils::is_pos_inside_map(c.pos, false))
+    if (!utils::is_pos_inside_map(p, false))
     {
         return false;
     }
@@ -128,8 +142,9 @@ bool All_adj_is_feature::check(const Cell& c) const
 
 bool All_adj_is_any_of_features::check(const Cell& c) const
 {
-    const int X = c.pos.x;
-    const int Y = c.pos.y;
+    const Pos p = c.pos;
+    const int X = p.x;
+    const int Y = p.y;
 
     if (X <= 0 || X >= MAP_W - 1 || Y <= 0 || Y >= MAP_H - 1)
     {
@@ -165,8 +180,9 @@ bool All_adj_is_any_of_features::check(const Cell& c) const
 
 bool All_adj_is_not_feature::check(const Cell& c) const
 {
-    const int X = c.pos.x;
-    const int Y = c.pos.y;
+    const Pos p = c.pos;
+    const int X = p.x;
+    const int Y = p.y;
 
     if (X <= 0 || X >= MAP_W - 1 || Y <= 0 || Y >= MAP_H - 1)
     {
@@ -189,8 +205,9 @@ bool All_adj_is_not_feature::check(const Cell& c) const
 
 bool All_adj_is_none_of_features::check(const Cell& c) const
 {
-    const int X = c.pos.x;
-    const int Y = c.pos.y;
+    const Pos p = c.pos;
+    const int X = p.x;
+    const int Y = p.y;
 
     if (X <= 0 || X >= MAP_W - 1 || Y <= 0 || Y >= MAP_H - 1)
     {
@@ -224,18 +241,63 @@ namespace map_parse
 
 const Rect map_rect(0, 0, MAP_W - 1, MAP_H - 1);
 
+namespace
+{
+
+//Sets the cells lacking any of the traits. The columns are contiguous in memory, and the
+//inner loop has no calls or branches, so it can be vectorized.
+template<bool IS_APPENDING>
+void run_traits(const unsigned char TRAITS, bool out[MAP_W][MAP_H], const Rect& area)
+{
+    for (int x = area.p0.x; x <= area.p1.x; ++x)
+    {
+        const unsigned char* const  traits  = map::cell_traits[x];
+        bool* const                 out_col = out[x];
+
+        for (int y = area.p0.y; y <= area.p1.y; ++y)
+        {
+            const bool IS_MATCH = (traits[y] & TRAITS) != TRAITS;
+
+            out_col[y] = IS_APPENDING ? (out_col[y] || IS_MATCH) : IS_MATCH;
+        }
+    }
+}
+
+} //namespace
+
 void run(const  cell_check::Check& check,
          bool   out[MAP_W][MAP_H],
          const  Map_parse_mode write_rule,
          const  Rect& area_to_check_cells)
 {
+    PROFILE_SCOPE("map_parse::run");
+
     assert(check.is_checking_cells()  ||
            check.is_checking_mobs()   ||
            check.is_checking_actors());
 
     const bool ALLOW_WRITE_FALSE = write_rule == Map_parse_mode::overwrite;
 
-    if (check.is_checking_cells())
+    const unsigned char REQUIRED_TRAITS = check.required_traits();
+
+    if (REQUIRED_TRAITS != 0)
+    {
+        if (ALLOW_WRITE_FALSE)
+        {
+            run_traits<false>(REQUIRED_TRAITS, out, area_to_check_cells);
+        }
+        else //Appending
+        {
+            run_traits<true>(REQUIRED_TRAITS, out, area_to_check_cells);
+        }
+
+        //Smoke is not a trait of the rigid
+        if (REQUIRED_TRAITS & feature_trait::is_los_passable)
+        {
+            fire_smoke::mark_smoke(out, area_to_check_cells);
+        }
+    }
+    else if (check.is_checking_cells())
     {
         for (int x = area_to_check_cells.p0.x; x <= area_to_check_cells.p1.x; ++x)
         {
@@ -462,46 +524,294 @@ void expand(const bool in[MAP_W][MAP_H], bool out[MAP_W][MAP_H], const int DIST)
     }
 }
 
-bool is_map_connected(const bool blocked[MAP_W][MAP_H])
+int label_components(const bool blocked[MAP_W][MAP_H], int out[MAP_W][MAP_H])
 {
-    Pos origin(-1, -1);
+    PROFILE_SCOPE("map_parse::label_components");
 
-    for (int x = 1; x < MAP_W - 1; ++x)
+    Union_find sets(MAP_W * MAP_H);
+
+    //First pass - merge each free cell with the free neighbours scanned before it
+    for (int x = 0; x < MAP_W; ++x)
     {
-        for (int y = 1; y < MAP_H - 1; ++y)
+        for (int y = 0; y < MAP_H; ++y)
         {
-            if (!blocked[x][y])
+            if (blocked[x][y])
+            {
+                continue;
+            }
+
+            const Pos prev_neighbours[] = {Pos(x - 1, y - 1), Pos(x - 1, y),
+                                           Pos(x - 1, y + 1), Pos(x, y - 1)
+                                          };
+
+            for (const Pos& p_adj : prev_neighbours)
             {
-                origin.set(x, y);
-                break;
+                if (utils::is_pos_inside_map(p_adj) && !blocked[p_adj.x][p_adj.y])
+                {
+                    sets.unite(x * MAP_H + y, p_adj.x * MAP_H + p_adj.y);
+                }
             }
         }
+    }
+
+    //Second pass - number the sets
+    std::vector<int> set_labels(MAP_W * MAP_H, -1);
 
-        if (origin.x != -1)
+    int nr_components = 0;
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
         {
-            break;
+            if (blocked[x][y])
+            {
+                out[x][y] = -1;
+                continue;
+            }
+
+            int& label = set_labels[sets.find(x * MAP_H + y)];
+
+            if (label < 0)
+            {
+                label = nr_components++;
+            }
+
+            out[x][y] = label;
         }
     }
 
-    assert(utils::is_pos_inside_map(origin, false));
+    return nr_components;
+}
+
+bool is_map_connected(const bool blocked[MAP_W][MAP_H])
+{
+    int labels[MAP_W][MAP_H];
+
+    const int NR_COMPONENTS = label_components(blocked, labels);
 
-    int flood_fill[MAP_W][MAP_H];
-    flood_fill::run(origin, blocked, flood_fill, INT_MAX, Pos(-1, -1), true);
+    assert(NR_COMPONENTS > 0);
 
-    //NOTE: We can skip to origin.x immediately, since this is guaranteed to be the
-    //leftmost non-blocked cell.
-    for (int x = origin.x; x < MAP_W - 1; ++x)
+    return NR_COMPONENTS == 1;
+}
+
+Map_connectivity::Map_connectivity(const bool blocked[MAP_W][MAP_H]) :
+    nr_components_          (0),
+    is_nr_components_valid_ (false),
+    is_cut_cells_valid_     (false)
+{
+    for (int x = 0; x < MAP_W; ++x)
     {
-        for (int y = 1; y < MAP_H - 1; ++y)
+        for (int y = 0; y < MAP_H; ++y)
         {
-            if (flood_fill[x][y] == 0 && !blocked[x][y] && Pos(x, y) != origin)
+            blocked_[x][y] = blocked[x][y];
+        }
+    }
+}
+
+bool Map_connectivity::is_connected()
+{
+    if (!is_nr_components_valid_)
+    {
+        update();
+    }
+
+    return nr_components_ <= 1;
+}
+
+bool Map_connectivity::is_connected_if_blocked(const Pos& p)
+{
+    assert(!blocked_[p.x][p.y]);
+
+    if (!is_connected())
+    {
+        return false;
+    }
+
+    if (nr_free_adj_groups(p) == 1)
+    {
+        return true;
+    }
+
+    if (!is_cut_cells_valid_)
+    {
+        update();
+    }
+
+    return !is_cut_cell_[p.x][p.y];
+}
+
+void Map_connectivity::block(const Pos& p)
+{
+    if (blocked_[p.x][p.y])
+    {
+        return;
+    }
+
+    const int NR_ADJ_GROUPS = nr_free_adj_groups(p);
+
+    blocked_[p.x][p.y] = true;
+
+    is_cut_cells_valid_ = false;
+
+    //If the neighbours were not connected around the cell, the map may have been split
+    if (NR_ADJ_GROUPS == 0)
+    {
+        --nr_components_;
+    }
+    else if (NR_ADJ_GROUPS > 1)
+    {
+        is_nr_components_valid_ = false;
+    }
+}
+
+int Map_connectivity::nr_free_adj_groups(const Pos& p) const
+{
+    Pos free_adj[8];
+    int group[8];
+    int nr_free = 0;
+
+    for (const Pos& d : dir_utils::dir_list)
+    {
+        const Pos p_adj(p + d);
+
+        if (utils::is_pos_inside_map(p_adj) && !blocked_[p_adj.x][p_adj.y])
+        {
+            free_adj[nr_free]   = p_adj;
+            group[nr_free]      = nr_free;
+            ++nr_free;
+        }
+    }
+
+    int nr_groups = nr_free;
+
+    for (int i = 0; i < nr_free; ++i)
+    {
+        for (int j = 0; j < i; ++j)
+        {
+            const int OLD_GROUP = group[i];
+            const int NEW_GROUP = group[j];
+
+            if (OLD_GROUP == NEW_GROUP || utils::king_dist(free_adj[i], free_adj[j]) > 1)
             {
-                return false;
+                continue;
+            }
+
+            for (int k = 0; k < nr_free; ++k)
+            {
+                if (group[k] == OLD_GROUP) {group[k] = NEW_GROUP;}
             }
+
+            --nr_groups;
         }
     }
 
-    return true;
+    return nr_groups;
+}
+
+void Map_connectivity::update()
+{
+    PROFILE_SCOPE("Map_connectivity::update");
+
+    is_nr_components_valid_ = true;
+    is_cut_cells_valid_     = true;
+    nr_components_          = 0;
+
+    //Discovery order and lowest reachable discovery order of each cell in the search
+    int disc[MAP_W][MAP_H];
+    int low[MAP_W][MAP_H];
+
+    utils::reset_array(disc);
+    utils::reset_array(is_cut_cell_, false);
+
+    struct Frame
+    {
+        Pos p;
+        int dir_idx;
+    };
+
+    //The search is done without recursion (it can be as deep as the number of free cells)
+    std::vector<Frame> stack;
+    stack.reserve(MAP_W * MAP_H);
+
+    int nr_visited = 0;
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            if (blocked_[x][y] || disc[x][y] != 0)
+            {
+                continue;
+            }
+
+            ++nr_components_;
+
+            disc[x][y] = low[x][y] = ++nr_visited;
+
+            stack.push_back({Pos(x, y), 0});
+
+            int nr_root_children = 0;
+
+            while (!stack.empty())
+            {
+                Frame& f = stack.back();
+
+                if (f.dir_idx < int(dir_utils::dir_list.size()))
+                {
+                    const Pos p_adj(f.p + dir_utils::dir_list[f.dir_idx]);
+
+                    ++f.dir_idx;
+
+                    if (!utils::is_pos_inside_map(p_adj) || blocked_[p_adj.x][p_adj.y])
+                    {
+                        continue;
+                    }
+
+                    if (disc[p_adj.x][p_adj.y] == 0)
+                    {
+                        if (stack.size() == 1)
+                        {
+                            ++nr_root_children;
+                        }
+
+                        disc[p_adj.x][p_adj.y] = low[p_adj.x][p_adj.y] = ++nr_visited;
+
+                        stack.push_back({p_adj, 0});
+                    }
+                    else
+                    {
+                        int& cur_low = low[f.p.x][f.p.y];
+
+                        cur_low = std::min(cur_low, disc[p_adj.x][p_adj.y]);
+                    }
+                }
+                else
+                {
+                    const Pos p(f.p);
+
+                    stack.pop_back();
+
+                    if (!stack.empty())
+                    {
+                        const Pos& parent = stack.back().p;
+
+                        int& parent_low = low[parent.x][parent.y];
+
+                        parent_low = std::min(parent_low, low[p.x][p.y]);
+
+                        //No cell below this one can reach above the parent without it
+                        if (stack.size() > 1 && low[p.x][p.y] >= disc[parent.x][parent.y])
+                        {
+                            is_cut_cell_[parent.x][parent.y] = true;
+                        }
+                    }
+                }
+            }
+
+            //The first cell splits the map if the search had to leave it several times
+            is_cut_cell_[x][y] = nr_root_children > 1;
+        }
+    }
 }
 
 } //map_parse
@@ -525,6 +835,8 @@ void run(const Pos& p0,
          const Pos& p1,
          const bool ALLOW_DIAGONAL)
 {
+    PROFILE_SCOPE("flood_fill::run");
+
     utils::reset_array(out);
 
     std::vector<Pos> positions;
@@ -631,6 +943,8 @@ namespace path_find
 void run(const Pos& p0, const Pos& p1, bool blocked[MAP_W][MAP_H], std::vector<Pos>& out,
          const bool ALLOW_DIAGONAL, const bool RANDOMIZE_STEP_CHOICES)
 {
+    PROFILE_SCOPE("path_find::run");
+
     out.clear();
 
     if (p0 == p1)
@@ -15,13 +15,14 @@
 #include "msg_log.hpp"
 #include "feature_rigid.hpp"
 #include "utils.hpp"
+#include "alloc_tracking.hpp"
 
 using namespace std;
 
 namespace map_travel
 {
 
-vector<map_data> map_list;
+thread_local vector<map_data> map_list;
 
 namespace
 {
@@ -30,6 +31,10 @@ void mk_lvl(const Map_type& map_type)
 {
     TRACE_FUNC_BEGIN;
 
+    ALLOC_TRACKING_ON_NEW_LVL(map::dlvl);
+
+    rnd::Stream_scope rnd_scope(rnd::Stream::mapgen);
+
     bool is_lvl_built = false;
 
 #ifndef NDEBUG
@@ -162,7 +167,6 @@ void go_to_nxt()
 
     map::player->restore_shock(map::player->shock_ / 2, true);
 
-    map::player->tgt_ = nullptr;
     game_time::update_light_map();
     map::player->update_fov();
     map::player->update_clr();
@@ -1,6 +1,7 @@
 #include "marker.hpp"
 
 #include <vector>
+#include <climits>
 
 #include "input.hpp"
 #include "inventory_handling.hpp"
@@ -40,7 +41,7 @@ void set_pos_to_closest_enemy_if_visible()
     {
         pos_ = utils::closest_pos(map::player->pos, seen_foes_cells);
 
-        map::player->tgt_ = utils::actor_at_pos(pos_);
+        map::player->set_tgt(utils::actor_at_pos(pos_));
     }
 }
 
@@ -53,7 +54,7 @@ void try_move(const Dir dir)
 
 bool set_pos_to_tgt_if_visible()
 {
-    const Actor* const tgt = map::player->tgt_;
+    const Actor* const tgt = map::player->tgt();
 
     if (tgt)
     {
@@ -93,7 +94,7 @@ Pos run(const Marker_draw_tail draw_trail,
         {
             //If no target available, attempt to place marker at closest visible monster.
             //This sets a new target if successful.
-            map::player->tgt_ = nullptr;
+            map::player->set_tgt(nullptr);
             set_pos_to_closest_enemy_if_visible();
         }
     }
@@ -2,6 +2,7 @@
 
 #include <vector>
 #include <string>
+#include <unordered_map>
 
 #include "init.hpp"
 #include "input.hpp"
@@ -20,20 +21,72 @@ namespace msg_log
 namespace
 {
 
-vector<Msg>           lines_[2];
-vector< vector<Msg> > history_;
-const string          more_str = "-More-";
+const size_t max_nr_history_msgs = 1000;
+
+thread_local vector<Msg>    lines_[2];
+
+//Changed whenever the current lines are, so the log is only drawn again if needed
+thread_local int            lines_rev_      = 0;
+thread_local int            drawn_rev_      = -1;
+
+//Ring buffer - when full, the oldest message is overwritten
+thread_local vector<Msg>    history_;
+thread_local size_t         history_start_  = 0;
+
+//The text of all messages in the log and history, with the number of messages using it
+thread_local unordered_map<string, int> texts_;
+
+thread_local bool           is_enabled_     = true;
+
+const string more_str = "-More-";
+
+const string* intern_text(const string& str)
+{
+    auto it = texts_.emplace(str, 0).first;
+
+    ++it->second;
+
+    //NOTE: Pointers to the elements of an unordered_map stay valid when it is rehashed
+    return &it->first;
+}
+
+void release_text(const Msg& msg)
+{
+    auto it = texts_.find(msg.str_raw());
+
+    assert(it != end(texts_));
+
+    if (--it->second == 0)
+    {
+        texts_.erase(it);
+    }
+}
+
+void add_to_history(const Msg& msg)
+{
+    if (history_.size() < max_nr_history_msgs)
+    {
+        history_.push_back(msg);
+        return;
+    }
+
+    Msg& oldest = history_[history_start_];
+
+    release_text(oldest);
+
+    oldest          = msg;
+    history_start_  = (history_start_ + 1) % history_.size();
+}
 
 int x_after_msg(const Msg* const msg)
 {
     if (!msg) {return 0;}
 
-    string str = "";
-    msg->str_with_repeats(str);
-    return msg->x_pos_ + str.size() + 1;
+    return msg->x_pos_ + msg->len_with_repeats() + 1;
 }
 
-void draw_history_interface(const int TOP_LINE_NR, const int BTM_LINE_NR)
+void draw_history_interface(const int TOP_LINE_NR, const int BTM_LINE_NR,
+                            const int NR_LINES_TOT)
 {
     const string decoration_line(MAP_W, '-');
 
@@ -41,7 +94,7 @@ void draw_history_interface(const int TOP_LINE_NR, const int BTM_LINE_NR)
 
     const int X_LABEL = 3;
 
-    if (history_.empty())
+    if (NR_LINES_TOT == 0)
     {
         render::draw_text(" No message history ", Panel::screen,
                           Pos(X_LABEL, 0), clr_gray);
@@ -51,7 +104,7 @@ void draw_history_interface(const int TOP_LINE_NR, const int BTM_LINE_NR)
         render::draw_text(
             " Displaying messages " + to_str(TOP_LINE_NR + 1) + "-" +
             to_str(BTM_LINE_NR + 1) + " of " +
-            to_str(history_.size()) + " ", Panel::screen, Pos(X_LABEL, 0), clr_gray);
+            to_str(NR_LINES_TOT) + " ", Panel::screen, Pos(X_LABEL, 0), clr_gray);
     }
 
     render::draw_text(decoration_line, Panel::screen, Pos(0, SCREEN_H - 1), clr_gray);
@@ -80,40 +133,52 @@ void init()
         line.clear();
     }
 
+    ++lines_rev_;
+
     history_.clear();
+    history_.reserve(max_nr_history_msgs);
+
+    history_start_ = 0;
+
+    texts_.clear();
 }
 
 void clear()
 {
+    //The messages (and the references to their text) are moved to the history
     for (vector<Msg>& line : lines_)
     {
-        if (!line.empty())
+        for (const Msg& msg : line)
         {
-            history_.push_back(line);
-
-            while (history_.size() > 300)
-            {
-                history_.erase(history_.begin());
-            }
-
-            line.clear();
+            add_to_history(msg);
         }
+
+        line.clear();
     }
+
+    ++lines_rev_;
 }
 
 void draw(const bool SHOULD_UPDATE_SCREEN)
 {
-    const int NR_LINES_WITH_CONTENT = lines_[0].empty() ? 0 :
-                                      lines_[1].empty() ? 1 : 2;
-
-    if (NR_LINES_WITH_CONTENT > 0)
+    //Only draw the log if it has changed, or was drawn over
+    if (!render::is_panel_retained(Panel::log) || drawn_rev_ != lines_rev_)
     {
-        render::cover_area(Panel::log, Pos(0, 0), Pos(MAP_W, NR_LINES_WITH_CONTENT));
+        render::begin_retained_panel(Panel::log);
+
+        render::cover_panel(Panel::log);
+
+        const int NR_LINES_WITH_CONTENT = lines_[0].empty() ? 0 :
+                                          lines_[1].empty() ? 1 : 2;
 
         for (int i = 0; i < NR_LINES_WITH_CONTENT; ++i)
         {
             draw_line(lines_[i], i);
         }
+
+        render::end_retained_panel();
+
+        drawn_rev_ = lines_rev_;
     }
 
     if (SHOULD_UPDATE_SCREEN)
@@ -139,14 +204,24 @@ void add(const string&              str,
 
 #endif
 
+    if (!is_enabled_)
+    {
+        if (INTERRUPT_PLAYER_ACTIONS)
+        {
+            map::player->interrupt_actions();
+        }
+
+        map::player->on_log_msg_printed();
+
+        return;
+    }
+
     //If frenzied, change message
     if (map::player->has_prop(Prop_id::frenzied))
     {
-        string frenzied_str = str;
-
         bool has_lower_case = false;
 
-        for (auto c : frenzied_str)
+        for (auto c : str)
         {
             if (c >= 'a' && c <= 'z')
             {
@@ -155,11 +230,13 @@ void add(const string&              str,
             }
         }
 
-        const char LAST           = frenzied_str.back();
+        const char LAST           = str.back();
         bool is_ended_by_punctuation = LAST == '.' || LAST == '!';
 
         if (has_lower_case && is_ended_by_punctuation)
         {
+            string frenzied_str = str;
+
             //Convert to upper case
             text_format::all_to_upper(frenzied_str);
 
@@ -196,13 +273,12 @@ void add(const string&              str,
     //Check if message is identical to previous
     if (add_more_prompt_on_msg == More_prompt_on_msg::no && prev_msg)
     {
-        string prev_str = "";
-        prev_msg->str_raw(prev_str);
-
-        if (prev_str.compare(str) == 0)
+        if (prev_msg->str_raw() == str)
         {
             prev_msg->incr_repeat();
             is_repeated = true;
+
+            ++lines_rev_;
         }
     }
 
@@ -232,7 +308,12 @@ void add(const string&              str,
             x_pos = 0;
         }
 
-        lines_[cur_line_nr].push_back(Msg(str, clr, x_pos));
+        //The first message since the log was cleared starts a new line in the history
+        const bool IS_NEW_LINE = lines_[0].empty();
+
+        lines_[cur_line_nr].push_back(Msg(intern_text(str), clr, x_pos, IS_NEW_LINE));
+
+        ++lines_rev_;
     }
 
     if (add_more_prompt_on_msg == More_prompt_on_msg::yes)
@@ -249,6 +330,16 @@ void add(const string&              str,
     map::player->on_log_msg_printed();
 }
 
+void set_enabled(const bool IS_ENABLED)
+{
+    is_enabled_ = IS_ENABLED;
+}
+
+bool is_enabled()
+{
+    return is_enabled_;
+}
+
 void more_prompt()
 {
     //If the current log is empty, do nothing
@@ -290,8 +381,11 @@ void display_history()
 {
     clear();
 
+    vector< vector<Msg> > lines;
+    history_lines(MAP_W, lines);
+
     const int LINE_JUMP           = 3;
-    const int NR_LINES_TOT        = history_.size();
+    const int NR_LINES_TOT        = lines.size();
     const int MAX_NR_LINES_ON_SCR = SCREEN_H - 2;
 
     int top_nr = max(0, NR_LINES_TOT - MAX_NR_LINES_ON_SCR);
@@ -300,12 +394,12 @@ void display_history()
     while (true)
     {
         render::clear_screen();
-        draw_history_interface(top_nr, btm_nr);
+        draw_history_interface(top_nr, btm_nr, NR_LINES_TOT);
         int y_pos = 1;
 
         for (int i = top_nr; i <= btm_nr; ++i)
         {
-            draw_line(history_[i], y_pos++);
+            draw_line(lines[i], y_pos++);
         }
 
         render::update_screen();
@@ -342,14 +436,35 @@ void display_history()
 
 void add_line_to_history(const string& line_to_add)
 {
-    vector<Msg> history_line;
-    history_line.push_back(Msg(line_to_add, clr_white, 0));
-    history_.push_back(history_line);
+    add_to_history(Msg(intern_text(line_to_add), clr_white, 0, true));
 }
 
-const vector< vector<Msg> >& history()
+void history_lines(const int W, vector< vector<Msg> >& out)
 {
-    return history_;
+    out.clear();
+
+    const size_t NR_MSGS = history_.size();
+
+    int x = 0;
+
+    for (size_t i = 0; i < NR_MSGS; ++i)
+    {
+        Msg msg = history_[(history_start_ + i) % NR_MSGS];
+
+        const int LEN = msg.len_with_repeats();
+
+        if (out.empty() || msg.is_new_line_ || (x > 0 && x + LEN > W))
+        {
+            out.push_back(vector<Msg>());
+            x = 0;
+        }
+
+        msg.x_pos_ = x;
+
+        out.back().push_back(msg);
+
+        x += LEN + 1;
+    }
 }
 
 } //log
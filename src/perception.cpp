@@ -0,0 +1,187 @@
+#include "perception.hpp"
+
+#include <algorithm>
+
+#include "init.hpp"
+#include "actor_mon.hpp"
+#include "actor_player.hpp"
+#include "game_time.hpp"
+#include "map.hpp"
+#include "map_parsing.hpp"
+#include "fov.hpp"
+#include "profiler.hpp"
+
+using namespace std;
+
+namespace perception
+{
+
+namespace
+{
+
+struct Result
+{
+    Result() :
+        gen         (-1),
+        seen_foes   () {}
+
+    //Generation of the handle of the monster the result was computed for
+    int             gen;
+    vector<Actor*>  seen_foes;
+};
+
+thread_local bool           is_valid_ = false;
+
+//Indexed by the slot of the monster handle (the vectors are reused between passes)
+thread_local vector<Result> results_;
+
+bool is_hostile_to_player(const Actor& actor)
+{
+    return !actor.is_player() && !actor.is_actor_my_leader(map::player);
+}
+
+void run()
+{
+    PROFILE_SCOPE("perception::run");
+
+    const vector<Actor*>& actors = game_time::actors_.elements();
+
+    const size_t NR_ACTORS = actors.size();
+
+    //Mark all results as stale, and find the area seen by any monster
+    for (Result& result : results_)
+    {
+        result.gen = -1;
+        result.seen_foes.clear();
+    }
+
+    Rect area(MAP_W, MAP_H, -1, -1);
+
+    for (const Actor* const actor : actors)
+    {
+        if (actor->is_player())
+        {
+            continue;
+        }
+
+        const Slot_handle& h = actor->handle;
+
+        if (h.idx >= int(results_.size()))
+        {
+            results_.resize(h.idx + 1);
+        }
+
+        results_[h.idx].gen = h.gen;
+
+        if (actor->is_alive())
+        {
+            const Rect fov_rect = fov::get_fov_rect(actor->pos);
+
+            area.p0.x = min(area.p0.x, fov_rect.p0.x);
+            area.p0.y = min(area.p0.y, fov_rect.p0.y);
+            area.p1.x = max(area.p1.x, fov_rect.p1.x);
+            area.p1.y = max(area.p1.y, fov_rect.p1.y);
+        }
+    }
+
+    if (area.p1.x < 0)
+    {
+        //No living monsters
+        is_valid_ = true;
+        return;
+    }
+
+    bool blocked_los[MAP_W][MAP_H];
+
+    map_parse::run(cell_check::Blocks_los(), blocked_los, Map_parse_mode::overwrite, area);
+
+    vector<bool> is_hostile(NR_ACTORS, false);
+
+    for (size_t i = 0; i < NR_ACTORS; ++i)
+    {
+        is_hostile[i] = is_hostile_to_player(*actors[i]);
+    }
+
+    //NOTE: The actors are added to the lists in the order of the actors vector, so each
+    //list is ordered the same way as if the monster had checked all actors by itself
+    for (size_t i = 0; i < NR_ACTORS; ++i)
+    {
+        Actor* const actor_i = actors[i];
+
+        if (!actor_i->is_alive())
+        {
+            continue;
+        }
+
+        for (size_t j = i + 1; j < NR_ACTORS; ++j)
+        {
+            Actor* const actor_j = actors[j];
+
+            if (
+                is_hostile[i] == is_hostile[j]  ||
+                !actor_j->is_alive()            ||
+                !fov::is_in_fov_range(actor_i->pos, actor_j->pos))
+            {
+                continue;
+            }
+
+            if (!actor_i->is_player())
+            {
+                const Mon* const mon = static_cast<const Mon*>(actor_i);
+
+                if (mon->can_see_actor(*actor_j, blocked_los))
+                {
+                    results_[actor_i->handle.idx].seen_foes.push_back(actor_j);
+                }
+            }
+
+            if (!actor_j->is_player())
+            {
+                const Mon* const mon = static_cast<const Mon*>(actor_j);
+
+                if (mon->can_see_actor(*actor_i, blocked_los))
+                {
+                    results_[actor_j->handle.idx].seen_foes.push_back(actor_i);
+                }
+            }
+        }
+    }
+
+    is_valid_ = true;
+}
+
+} //namespace
+
+void invalidate()
+{
+    is_valid_ = false;
+}
+
+bool seen_foes(const Mon& mon, vector<Actor*>& out)
+{
+    out.clear();
+
+    if (!is_valid_)
+    {
+        run();
+    }
+
+    const Slot_handle& h = mon.handle;
+
+    if (h.idx < 0 || h.idx >= int(results_.size()) || results_[h.idx].gen != h.gen)
+    {
+        return false;
+    }
+
+    for (Actor* const actor : results_[h.idx].seen_foes)
+    {
+        if (actor->is_alive())
+        {
+            out.push_back(actor);
+        }
+    }
+
+    return true;
+}
+
+} //perception
@@ -11,16 +11,18 @@
 #include "player_spells_handling.hpp"
 #include "map.hpp"
 #include "map_parsing.hpp"
+#include "utils.hpp"
 
 namespace player_bon
 {
 
-bool traits[int(Trait::END)];
+thread_local bool traits[int(Trait::END)];
 
 namespace
 {
 
-Bg bg_ = Bg::END;
+thread_local Bg  bg_         = Bg::END;
+thread_local int version_    = 0;
 
 } //Namespace
 
@@ -32,6 +34,8 @@ void init()
     }
 
     bg_ = Bg::END;
+
+    ++version_;
 }
 
 void store_to_save_lines(std::vector<std::string>& lines)
@@ -54,6 +58,8 @@ void setup_from_save_lines(std::vector<std::string>& lines)
         traits[i] = lines.front() == "1";
         lines.erase(begin(lines));
     }
+
+    ++version_;
 }
 
 std::string bg_title(const Bg id)
@@ -639,6 +645,11 @@ void trait_prereqs(const Trait id, std::vector<Trait>& traits_ref, Bg& bg_ref)
     });
 }
 
+int version()
+{
+    return version_;
+}
+
 Bg bg()
 {
     return bg_;
@@ -690,7 +701,7 @@ void pickable_traits(std::vector<Trait>& traits_ref)
     }
 
     //Limit the number of trait choices (due to screen space constraints)
-    random_shuffle(traits_ref.begin(), traits_ref.end());
+    rnd::shuffle(traits_ref);
     const int MAX_NR_TRAIT_CHOICES = 16;
     traits_ref.resize(std::min(int(traits_ref.size()), MAX_NR_TRAIT_CHOICES));
 
@@ -709,6 +720,8 @@ void pick_bg(const Bg bg)
 
     bg_ = bg;
 
+    ++version_;
+
     switch (bg_)
     {
     case Bg::ghoul:
@@ -750,6 +763,8 @@ void set_all_traits_to_picked()
     {
         traits[i] = true;
     }
+
+    ++version_;
 }
 
 void pick_trait(const Trait id)
@@ -758,6 +773,8 @@ void pick_trait(const Trait id)
 
     traits[int(id)] = true;
 
+    ++version_;
+
     switch (id)
     {
     case Trait::tough:
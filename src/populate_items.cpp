@@ -16,6 +16,8 @@ namespace populate_items
 
 void mk_items_on_floor()
 {
+    rnd::Stream_scope rnd_scope(rnd::Stream::loot);
+
     int nr_spawns = rnd::range(6, 8);
 
     if (player_bon::traits[int(Trait::treasure_hunter)])
@@ -144,7 +144,9 @@ void mk_info_lines(std::vector<Str_and_clr>& out)
     out.push_back(Str_and_clr(" ", clr_info));
 
     out.push_back(Str_and_clr(" Last messages:", clr_heading));
-    const std::vector< std::vector<Msg> >& history = msg_log::history();
+    std::vector< std::vector<Msg> > history;
+    msg_log::history_lines(MAP_W, history);
+
     int history_element = std::max(0, int(history.size()) - 20);
 
     for (size_t i = history_element; i < history.size(); ++i)
@@ -214,8 +216,10 @@ void mk_info_lines(std::vector<Str_and_clr>& out)
                     const auto& rubble_high_d = feature_data::data(Feature_id::rubble_high);
                     const auto& statue_d     = feature_data::data(Feature_id::statue);
 
+                    //NOTE: Walls may be drawn as a full square (see Wall::glyph())
                     if (
                         render::render_array[x][y].glyph == wall_d.glyph ||
+                        render::render_array[x][y].glyph == 10           ||
                         render::render_array[x][y].glyph == rubble_high_d.glyph)
                     {
                         cur_row.push_back('#');
@@ -0,0 +1,332 @@
+#include "profiler.hpp"
+
+#ifdef PROFILER
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <SDL.h>
+
+namespace profiler
+{
+
+namespace
+{
+
+typedef std::chrono::steady_clock Clock;
+
+const int MAX_NR_IDS = 128;
+
+//Scopes ending after this many samples in a turn are still counted in the turn numbers, but
+//they are left out of the trace
+const size_t MAX_NR_SAMPLES = 1 << 16;
+
+//The names are shared by all threads - they are only ever added, under the lock
+const char*     names_[MAX_NR_IDS];
+SDL_atomic_t    nr_ids_;
+SDL_SpinLock    names_lock_ = 0;
+
+SDL_atomic_t    next_thread_nr_;
+
+struct Stats
+{
+    long long   nr_calls;
+    long long   count;
+    double      total_us;
+    double      self_us;
+};
+
+//A timed scope, to be written to the trace
+struct Sample
+{
+    int     id;
+    double  start_us;
+    double  dur_us;
+};
+
+struct Thread_state
+{
+    bool                is_enabled;
+    int                 thread_nr;
+    FILE*               csv;
+    FILE*               trace;
+    bool                is_first_event;
+    Clock::time_point   t0;
+    double              turn_start_us;
+    int                 turn_nr;
+    Scope*              top;
+    Stats               stats[MAX_NR_IDS];
+    std::vector<Sample> samples;
+    long long           nr_dropped_samples;
+};
+
+thread_local Thread_state state_;
+
+double now_us()
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - state_.t0).count();
+}
+
+//Writes the separator before a trace event
+void begin_trace_event()
+{
+    fprintf(state_.trace, "%s\n", state_.is_first_event ? "" : ",");
+
+    state_.is_first_event = false;
+}
+
+void write_csv_row(const char* const name, const Stats& s)
+{
+    fprintf(state_.csv, "%d,%s,%lld,%.1f,%.1f,%lld\n",
+            state_.turn_nr, name, s.nr_calls, s.total_us, s.self_us, s.count);
+}
+
+//Writes the samples collected since the last write to the trace
+void write_samples()
+{
+    for (const Sample& sample : state_.samples)
+    {
+        begin_trace_event();
+
+        fprintf(state_.trace,
+                "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.1f,\"dur\":%.1f,\"pid\":1,\"tid\":%d}",
+                names_[sample.id], sample.start_us, sample.dur_us, state_.thread_nr);
+    }
+
+    state_.samples.clear();
+
+    if (state_.nr_dropped_samples > 0)
+    {
+        begin_trace_event();
+
+        fprintf(state_.trace,
+                "{\"name\":\"dropped_samples\",\"ph\":\"C\",\"ts\":%.1f,\"pid\":1,"
+                "\"tid\":%d,\"args\":{\"value\":%lld}}",
+                now_us(), state_.thread_nr, state_.nr_dropped_samples);
+
+        state_.nr_dropped_samples = 0;
+    }
+}
+
+void write_turn()
+{
+    const int NR_IDS = SDL_AtomicGet(&nr_ids_);
+
+    Stats turn_stats;
+
+    memset(&turn_stats, 0, sizeof(turn_stats));
+
+    turn_stats.nr_calls = 1;
+    turn_stats.total_us = now_us() - state_.turn_start_us;
+
+    write_csv_row("turn", turn_stats);
+
+    for (int i = 0; i < NR_IDS; ++i)
+    {
+        Stats& s = state_.stats[i];
+
+        if (s.nr_calls > 0)
+        {
+            write_csv_row(names_[i], s);
+
+            if (s.count != 0)
+            {
+                begin_trace_event();
+
+                fprintf(state_.trace,
+                        "{\"name\":\"%s\",\"ph\":\"C\",\"ts\":%.1f,\"pid\":1,\"tid\":%d,"
+                        "\"args\":{\"value\":%lld}}",
+                        names_[i], now_us(), state_.thread_nr, s.count);
+            }
+        }
+
+        memset(&s, 0, sizeof(s));
+    }
+
+    write_samples();
+}
+
+} //namespace
+
+void init(const std::string& name)
+{
+    assert(!state_.is_enabled);
+
+    memset(state_.stats, 0, sizeof(state_.stats));
+
+    state_.thread_nr        = SDL_AtomicAdd(&next_thread_nr_, 1) + 1;
+    state_.csv              = fopen((name + "_turns.csv").c_str(), "w");
+    state_.trace            = fopen((name + "_trace.json").c_str(), "w");
+    state_.is_first_event   = true;
+    state_.t0               = Clock::now();
+    state_.turn_start_us    = 0.0;
+    state_.turn_nr          = 0;
+    state_.top              = nullptr;
+
+    state_.samples.reserve(MAX_NR_SAMPLES);
+    state_.nr_dropped_samples = 0;
+
+    if (!state_.csv || !state_.trace)
+    {
+        TRACE << "Failed to open profiler output files with name: " << name << std::endl;
+
+        if (state_.csv)     {fclose(state_.csv);}
+        if (state_.trace)   {fclose(state_.trace);}
+
+        return;
+    }
+
+    fprintf(state_.csv, "turn,name,calls,total_us,self_us,count\n");
+    fprintf(state_.trace, "[");
+
+    state_.is_enabled = true;
+}
+
+void cleanup()
+{
+    if (!state_.is_enabled)
+    {
+        return;
+    }
+
+    write_turn();
+
+    fprintf(state_.trace, "\n]\n");
+
+    fclose(state_.csv);
+    fclose(state_.trace);
+
+    state_.is_enabled = false;
+}
+
+void on_new_turn(const int TURN_NR)
+{
+    if (!state_.is_enabled)
+    {
+        return;
+    }
+
+    const double WRITE_START_US = now_us();
+
+    write_turn();
+
+    //The scopes which are open now should not include the time spent writing
+    if (state_.top)
+    {
+        state_.top->exclude_us(now_us() - WRITE_START_US);
+    }
+
+    state_.turn_nr          = TURN_NR;
+    state_.turn_start_us    = now_us();
+}
+
+int id(const char* const name)
+{
+    SDL_AtomicLock(&names_lock_);
+
+    const int NR_IDS = SDL_AtomicGet(&nr_ids_);
+
+    int ret = -1;
+
+    for (int i = 0; i < NR_IDS; ++i)
+    {
+        if (strcmp(names_[i], name) == 0)
+        {
+            ret = i;
+            break;
+        }
+    }
+
+    if (ret < 0)
+    {
+        assert(NR_IDS < MAX_NR_IDS);
+
+        ret         = NR_IDS;
+        names_[ret] = name;
+
+        SDL_AtomicSet(&nr_ids_, NR_IDS + 1);
+    }
+
+    SDL_AtomicUnlock(&names_lock_);
+
+    return ret;
+}
+
+void count(const int ID, const long long VAL)
+{
+    if (state_.is_enabled)
+    {
+        Stats& s = state_.stats[ID];
+
+        ++s.nr_calls;
+        s.count += VAL;
+    }
+}
+
+Scope::Scope(const int ID) :
+    id_         (state_.is_enabled ? ID : -1),
+    parent_     (nullptr),
+    start_us_   (0.0),
+    child_us_   (0.0),
+    excluded_us_(0.0)
+{
+    if (id_ >= 0)
+    {
+        parent_     = state_.top;
+        state_.top  = this;
+        start_us_   = now_us();
+    }
+}
+
+Scope::~Scope()
+{
+    //Not recording, or the recording was stopped while this scope was open
+    if (id_ < 0 || !state_.is_enabled)
+    {
+        return;
+    }
+
+    const double DUR_US = now_us() - start_us_ - excluded_us_;
+
+    Stats& s = state_.stats[id_];
+
+    ++s.nr_calls;
+    s.total_us  += DUR_US;
+    s.self_us   += DUR_US - child_us_;
+
+    if (parent_)
+    {
+        parent_->child_us_ += DUR_US;
+    }
+
+    state_.top = parent_;
+
+    //The sample is written at the start of the next turn, so that no time is spent on
+    //writing inside the scopes (and the buffer is never grown while recording)
+    if (state_.samples.size() < MAX_NR_SAMPLES)
+    {
+        //Any excluded time is left out at the start, so the scope still ends after the
+        //scopes inside it in the trace
+        state_.samples.push_back({id_, start_us_ + excluded_us_, DUR_US});
+    }
+    else
+    {
+        ++state_.nr_dropped_samples;
+    }
+}
+
+void Scope::exclude_us(const double US)
+{
+    excluded_us_ += US;
+
+    if (parent_)
+    {
+        parent_->exclude_us(US);
+    }
+}
+
+} //profiler
+
+#endif //PROFILER
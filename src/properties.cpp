@@ -24,14 +24,15 @@
 namespace prop_data
 {
 
-Prop_data_t data[size_t(Prop_id::END)];
-
 namespace
 {
 
+//Never changed after it is built, so it is shared by all sessions (and threads)
+Prop_data_t data_list[size_t(Prop_id::END)];
+
 void add_prop_data(Prop_data_t& d)
 {
-    data[int(d.id)] = d;
+    data_list[int(d.id)] = d;
     Prop_data_t blank;
     d = blank;
 }
@@ -730,9 +731,14 @@ void init_data_list()
 
 } //namespace
 
+const Prop_data_t (&data)[size_t(Prop_id::END)] = data_list;
+
 void init()
 {
-    init_data_list();
+    //Only built once per process
+    static const bool IS_DATA_BUILT = (init_data_list(), true);
+
+    (void)IS_DATA_BUILT;
 }
 
 } //Prop_data
@@ -741,7 +747,8 @@ void init()
 // Property handler
 //-----------------------------------------------------------------------------
 Prop_handler::Prop_handler(Actor* owning_actor) :
-    owning_actor_(owning_actor)
+    version_        (0),
+    owning_actor_   (owning_actor)
 {
     //Reset the active props info
     for (size_t i = 0; i < size_t(Prop_id::END); ++i)
@@ -1117,6 +1124,8 @@ void Prop_handler::try_add_prop(Prop* const prop,
 
                 old_prop->on_more();
 
+                ++version_;
+
                 old_prop->nr_turns_left_ = (TURNS_LEFT_OLD < 0 || TURNS_LEFT_NEW < 0) ? -1 :
                                            std::max(TURNS_LEFT_OLD, TURNS_LEFT_NEW);
                 delete prop;
@@ -1129,6 +1138,8 @@ void Prop_handler::try_add_prop(Prop* const prop,
 
     props_.push_back(prop);
 
+    ++version_;
+
     prop->on_start();
 
     if (verbosity == Verbosity::verbose)
@@ -1203,6 +1214,8 @@ void Prop_handler::remove_props_for_item(const Item* const item)
             run_prop_end(prop);
 
             props_.erase(begin(props_) + i);
+
+            ++version_;
         }
         else //Property was not added by this item
         {
@@ -1331,6 +1344,8 @@ bool Prop_handler::end_prop(const Prop_id id, const bool RUN_PROP_END_EFFECTS)
 
     props_.erase(begin(props_) + idx);
 
+    ++version_;
+
     if (RUN_PROP_END_EFFECTS)
     {
         run_prop_end(prop);
@@ -1358,6 +1373,8 @@ void Prop_handler::end_props_by_magic_healing()
             delete prop;
 
             props_.erase(begin(props_) + i);
+
+            ++version_;
         }
         else //Property was not added by this item
         {
@@ -1408,6 +1425,8 @@ void Prop_handler::tick(const Prop_turn_mode turn_mode)
                 prop = nullptr;
 
                 props_.erase(begin(props_) + i);
+
+                ++version_;
             }
             else //Not finished
             {
@@ -2027,20 +2046,30 @@ void Prop_frenzied::change_move_dir(const Pos& actor_pos, Dir& dir)
         bool blocked[MAP_W][MAP_H];
         map_parse::run(cell_check::Blocks_actor(*owning_actor_, false), blocked);
 
-        std::vector<Pos> line;
-        line_calc::calc_new_line(actor_pos, closest_mon_pos, true, 999, false, line);
+        line_calc::Line_iter line(actor_pos, closest_mon_pos, true, 999, false);
+
+        Pos pos;
+        Pos first_step;
+        int nr_pos = 0;
 
-        if (line.size() > 1)
+        while (line.next(pos))
         {
-            for (Pos& pos : line)
+            if (blocked[pos.x][pos.y])
             {
-                if (blocked[pos.x][pos.y])
-                {
-                    return;
-                }
+                return;
+            }
+
+            if (nr_pos == 1)
+            {
+                first_step = pos;
             }
 
-            dir = dir_utils::dir(line[1] - actor_pos);
+            ++nr_pos;
+        }
+
+        if (nr_pos > 1)
+        {
+            dir = dir_utils::dir(first_step - actor_pos);
         }
     }
 }
@@ -2,6 +2,9 @@
 
 #include <vector>
 #include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
 
 #include "init.hpp"
 #include "item.hpp"
@@ -15,6 +18,8 @@
 #include "attack.hpp"
 #include "feature_mob.hpp"
 #include "feature_door.hpp"
+#include "fire_smoke.hpp"
+#include "profiler.hpp"
 #include "inventory.hpp"
 #include "utils.hpp"
 #include "cmn_data.hpp"
@@ -24,8 +29,9 @@
 namespace render
 {
 
-Cell_render_data render_array[MAP_W][MAP_H];
-Cell_render_data render_array_no_actors[MAP_W][MAP_H];
+thread_local Cell_render_data render_array[MAP_W][MAP_H];
+thread_local Cell_render_data render_array_no_actors[MAP_W][MAP_H];
+thread_local Cell_render_data player_visual_memory[MAP_W][MAP_H];
 
 namespace
 {
@@ -45,11 +51,114 @@ bool tile_px_data_[PIXEL_DATA_W][PIXEL_DATA_H];
 bool font_px_data_[PIXEL_DATA_W][PIXEL_DATA_H];
 bool contour_px_data_[PIXEL_DATA_W][PIXEL_DATA_H];
 
+bool            is_char_lines_retained_ = false;
+bool            is_log_retained_        = false;
+
+bool            is_drawing_retained_    = false;
+Panel           retained_panel_drawn_   = Panel::screen;
+
+//The area of the screen surface drawn on since the screen was last updated (in pixels)
+bool            is_scr_dirty_           = false;
+Rect            dirty_px_area_;
+
+//While the present loop runs, the game runs on a thread of its own, and the main thread owns
+//the window and the SDL renderer. The game thread publishes the frames drawn on the screen
+//surface (by copying the changed area to a shared buffer), and the main thread uploads and
+//presents them. Anything else touching the window is run on the main thread as a task.
+SDL_mutex*          frame_mutex_                = nullptr;
+SDL_cond*           frame_cond_                 = nullptr;
+
+//Guarded by the frame mutex (but only changed by the game thread while it runs)
+bool                is_present_loop_running_    = false;
+
+//Guarded by the frame mutex
+bool                is_frame_published_         = false;
+bool                is_published_dirty_         = false;
+Rect                published_px_area_;
+std::vector<Uint8>  published_px_;
+void              (*window_task_)()             = nullptr;
+
 bool is_inited()
 {
     return sdl_window_;
 }
 
+Rect panel_px_area(const Panel panel)
+{
+    const int SCR_PX_W = config::scr_px_w();
+
+    switch (panel)
+    {
+    case Panel::screen:
+        return Rect(0, 0, SCR_PX_W - 1, config::scr_px_h() - 1);
+
+    case Panel::map:
+    {
+        const int Y0 = config::map_px_offset_h();
+        return Rect(0, Y0, SCR_PX_W - 1, Y0 + config::map_px_h() - 1);
+    }
+
+    case Panel::log:
+        return Rect(0, 0, SCR_PX_W - 1, config::log_px_h() - 1);
+
+    case Panel::char_lines:
+    {
+        const int Y0 = config::char_lines_px_offset_h();
+        return Rect(0, Y0, SCR_PX_W - 1, Y0 + config::char_lines_px_h() - 1);
+    }
+    }
+
+    return Rect();
+}
+
+bool is_overlapping(const Rect& r1, const Rect& r2)
+{
+    return r1.p0.x <= r2.p1.x && r1.p1.x >= r2.p0.x &&
+           r1.p0.y <= r2.p1.y && r1.p1.y >= r2.p0.y;
+}
+
+void invalidate_if_drawn_over(const Panel panel, bool& is_retained, const Rect& px_area)
+{
+    const bool IS_PANEL_DRAWN = is_drawing_retained_ && retained_panel_drawn_ == panel;
+
+    if (is_retained && !IS_PANEL_DRAWN && is_overlapping(px_area, panel_px_area(panel)))
+    {
+        is_retained = false;
+    }
+}
+
+//Must be called for all drawing on the screen surface
+void on_px_area_drawn(const Pos& px_pos, const Pos& px_dims)
+{
+    if (px_dims.x <= 0 || px_dims.y <= 0)
+    {
+        return;
+    }
+
+    const Rect px_area(px_pos, px_pos + px_dims - 1);
+
+    if (is_scr_dirty_)
+    {
+        dirty_px_area_.p0.x = std::min(dirty_px_area_.p0.x, px_area.p0.x);
+        dirty_px_area_.p0.y = std::min(dirty_px_area_.p0.y, px_area.p0.y);
+        dirty_px_area_.p1.x = std::max(dirty_px_area_.p1.x, px_area.p1.x);
+        dirty_px_area_.p1.y = std::max(dirty_px_area_.p1.y, px_area.p1.y);
+    }
+    else
+    {
+        dirty_px_area_  = px_area;
+        is_scr_dirty_   = true;
+    }
+
+    invalidate_if_drawn_over(Panel::char_lines, is_char_lines_retained_,  px_area);
+    invalidate_if_drawn_over(Panel::log,        is_log_retained_,         px_area);
+}
+
+void on_scr_drawn()
+{
+    on_px_area_drawn(Pos(0, 0), Pos(config::scr_px_w(), config::scr_px_h()));
+}
+
 void div_clr(Clr & clr, const double DIV)
 {
     clr.r = double(clr.r) / DIV;
@@ -142,6 +251,8 @@ void blit_surface(SDL_Surface& srf, const Pos& px_pos)
     };
 
     SDL_BlitSurface(&srf, nullptr, scr_srf_, &dst_rect);
+
+    on_px_area_drawn(px_pos, Pos(srf.w, srf.h));
 }
 
 void load_main_menu_logo()
@@ -165,6 +276,10 @@ void load_font()
 
     SDL_Surface* font_srf_tmp = IMG_Load(config::font_name().data());
 
+    //Clear any pixels outside the image left from a previous font, so that the cached
+    //data only depends on the image
+    std::fill(&font_px_data_[0][0], &font_px_data_[0][0] + PIXEL_DATA_W * PIXEL_DATA_H, false);
+
     Uint32 img_clr = SDL_MapRGB(font_srf_tmp->format, 255, 255, 255);
 
     for (int x = 0; x < font_srf_tmp->w; ++x)
@@ -188,6 +303,8 @@ void load_tiles()
 
     SDL_Surface* tile_srf_tmp = IMG_Load(tiles_img_name.data());
 
+    std::fill(&tile_px_data_[0][0], &tile_px_data_[0][0] + PIXEL_DATA_W * PIXEL_DATA_H, false);
+
     Uint32 img_clr = SDL_MapRGB(tile_srf_tmp->format, 255, 255, 255);
 
     for (int x = 0; x < tile_srf_tmp->w; ++x)
@@ -251,6 +368,249 @@ void load_contour(const bool base[PIXEL_DATA_W][PIXEL_DATA_H])
     }
 }
 
+//---------------------------------------------------------------- PIXEL DATA CACHE
+//The font, tile and contour pixel data is stored in a cache file per font (and tiles mode),
+//so that it does not need to be decoded from the images on every start or font change. The
+//cache is rebuilt when any of the images differ from when it was written.
+
+const Uint32 PX_CACHE_VERSION = 1;
+
+const size_t PX_DATA_NR_BYTES = (PIXEL_DATA_W * PIXEL_DATA_H + 7) / 8;
+
+//FNV-1a hash of the file contents (zero if the file can not be read)
+Uint32 file_checksum(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        return 0;
+    }
+
+    Uint32 hash = 2166136261u;
+
+    char buffer[4096];
+
+    while (file)
+    {
+        file.read(buffer, sizeof(buffer));
+
+        const std::streamsize NR_READ = file.gcount();
+
+        for (std::streamsize i = 0; i < NR_READ; ++i)
+        {
+            hash = (hash ^ Uint8(buffer[i])) * 16777619u;
+        }
+    }
+
+    return hash;
+}
+
+struct Px_cache_header
+{
+    char    magic[4];
+    Uint32  version;
+    Uint32  font_checksum;
+    Uint32  tiles_checksum;
+    Sint32  cell_px_w;
+    Sint32  cell_px_h;
+    Uint32  is_tiles_mode;
+};
+
+Px_cache_header mk_px_cache_header()
+{
+    const bool IS_TILES = config::is_tiles_mode();
+
+    Px_cache_header h;
+
+    h.magic[0]          = 'I';
+    h.magic[1]          = 'A';
+    h.magic[2]          = 'P';
+    h.magic[3]          = 'X';
+    h.version           = PX_CACHE_VERSION;
+    h.font_checksum     = file_checksum(config::font_name());
+    h.tiles_checksum    = IS_TILES ? file_checksum(tiles_img_name) : 0;
+    h.cell_px_w         = config::cell_px_w();
+    h.cell_px_h         = config::cell_px_h();
+    h.is_tiles_mode     = IS_TILES;
+
+    return h;
+}
+
+bool is_px_cache_header_eq(const Px_cache_header& h1, const Px_cache_header& h2)
+{
+    return
+        std::equal(h1.magic, h1.magic + 4, h2.magic)  &&
+        h1.version          == h2.version               &&
+        h1.font_checksum    == h2.font_checksum         &&
+        h1.tiles_checksum   == h2.tiles_checksum        &&
+        h1.cell_px_w        == h2.cell_px_w             &&
+        h1.cell_px_h        == h2.cell_px_h             &&
+        h1.is_tiles_mode    == h2.is_tiles_mode;
+}
+
+std::string px_cache_path()
+{
+    //E.g. "images/16x24_v1.png" -> "data/px_cache_16x24_v1"
+    std::string font_base_name = config::font_name();
+
+    const size_t DIR_END_POS = font_base_name.find_last_of('/');
+
+    if (DIR_END_POS != std::string::npos)
+    {
+        font_base_name.erase(0, DIR_END_POS + 1);
+    }
+
+    const size_t EXT_POS = font_base_name.find_last_of('.');
+
+    if (EXT_POS != std::string::npos)
+    {
+        font_base_name.erase(EXT_POS);
+    }
+
+    return "data/px_cache_" + font_base_name + (config::is_tiles_mode() ? "_tiles" : "");
+}
+
+void pack_px_data(const bool px_data[PIXEL_DATA_W][PIXEL_DATA_H], std::vector<char>& out)
+{
+    out.assign(PX_DATA_NR_BYTES, 0);
+
+    size_t bit_idx = 0;
+
+    for (size_t x = 0; x < PIXEL_DATA_W; ++x)
+    {
+        for (size_t y = 0; y < PIXEL_DATA_H; ++y)
+        {
+            if (px_data[x][y])
+            {
+                out[bit_idx / 8] |= char(1 << (bit_idx % 8));
+            }
+
+            ++bit_idx;
+        }
+    }
+}
+
+void unpack_px_data(const std::vector<char>& in, bool px_data[PIXEL_DATA_W][PIXEL_DATA_H])
+{
+    size_t bit_idx = 0;
+
+    for (size_t x = 0; x < PIXEL_DATA_W; ++x)
+    {
+        for (size_t y = 0; y < PIXEL_DATA_H; ++y)
+        {
+            px_data[x][y] = (in[bit_idx / 8] >> (bit_idx % 8)) & 1;
+
+            ++bit_idx;
+        }
+    }
+}
+
+bool read_px_cache(const std::string& path, const Px_cache_header& expected_header)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    Px_cache_header header;
+
+    file.read(reinterpret_cast<char*>(&header), sizeof(header));
+
+    if (!file || !is_px_cache_header_eq(header, expected_header))
+    {
+        TRACE << "Pixel data cache is outdated: " << path << std::endl;
+        return false;
+    }
+
+    //Read everything before writing to the pixel arrays, so that a truncated file does not
+    //leave a mix of old and new data
+    std::vector<char> font_bytes(PX_DATA_NR_BYTES);
+    std::vector<char> tile_bytes(header.is_tiles_mode ? PX_DATA_NR_BYTES : 0);
+    std::vector<char> contour_bytes(PX_DATA_NR_BYTES);
+
+    file.read(font_bytes.data(),    font_bytes.size());
+    file.read(tile_bytes.data(),    tile_bytes.size());
+    file.read(contour_bytes.data(), contour_bytes.size());
+
+    if (!file)
+    {
+        TRACE << "Pixel data cache is truncated: " << path << std::endl;
+        return false;
+    }
+
+    unpack_px_data(font_bytes, font_px_data_);
+
+    if (header.is_tiles_mode)
+    {
+        unpack_px_data(tile_bytes, tile_px_data_);
+    }
+
+    unpack_px_data(contour_bytes, contour_px_data_);
+
+    return true;
+}
+
+void write_px_cache(const std::string& path, const Px_cache_header& header)
+{
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+
+    if (!file.is_open())
+    {
+        TRACE << "Failed to write pixel data cache: " << path << std::endl;
+        return;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+
+    std::vector<char> bytes;
+
+    pack_px_data(font_px_data_, bytes);
+    file.write(bytes.data(), bytes.size());
+
+    if (header.is_tiles_mode)
+    {
+        pack_px_data(tile_px_data_, bytes);
+        file.write(bytes.data(), bytes.size());
+    }
+
+    pack_px_data(contour_px_data_, bytes);
+    file.write(bytes.data(), bytes.size());
+}
+
+//Sets up the font, tile and contour pixel data - from the cache if it is up to date,
+//otherwise from the images (and then the cache is rewritten)
+void load_px_data()
+{
+    TRACE_FUNC_BEGIN;
+
+    const Px_cache_header   header  = mk_px_cache_header();
+    const std::string       path    = px_cache_path();
+
+    if (read_px_cache(path, header))
+    {
+        TRACE_FUNC_END;
+        return;
+    }
+
+    const bool IS_TILES = config::is_tiles_mode();
+
+    load_font();
+
+    if (IS_TILES)
+    {
+        load_tiles();
+    }
+
+    load_contour(IS_TILES ? tile_px_data_ : font_px_data_);
+
+    write_px_cache(path, header);
+
+    TRACE_FUNC_END;
+}
+
 void put_pixels_on_scr(const bool px_data[PIXEL_DATA_W][PIXEL_DATA_H],
                        const Pos& sheet_pos, const Pos& scr_px_pos, const Clr& clr)
 {
@@ -267,6 +627,8 @@ void put_pixels_on_scr(const bool px_data[PIXEL_DATA_W][PIXEL_DATA_H],
         const int SCR_PX_X0   = scr_px_pos.x;
         const int SCR_PX_Y0   = scr_px_pos.y;
 
+        on_px_area_drawn(scr_px_pos, Pos(CELL_W, CELL_H));
+
         int scr_px_x = SCR_PX_X0;
 
         for (int sheet_px_x = SHEET_PX_X0; sheet_px_x <= SHEET_PX_X1; sheet_px_x++)
@@ -399,10 +761,82 @@ void draw_glyph_at_px(const char GLYPH, const Pos& px_pos, const Clr& clr,
     put_pixels_on_scr_for_glyph(GLYPH, px_pos, clr);
 }
 
+Rect clip_to_scr(const Rect& px_area)
+{
+    const Rect scr_area = panel_px_area(Panel::screen);
+
+    return Rect(std::max(px_area.p0.x, scr_area.p0.x),
+                std::max(px_area.p0.y, scr_area.p0.y),
+                std::min(px_area.p1.x, scr_area.p1.x),
+                std::min(px_area.p1.y, scr_area.p1.y));
+}
+
+//Copies an area of pixels between buffers laid out like the screen surface
+void copy_px_area(const Uint8* const src, Uint8* const dst, const Rect& px_area)
+{
+    const int PITCH         = scr_srf_->pitch;
+    const int BPP           = scr_srf_->format->BytesPerPixel;
+    const int ROW_NR_BYTES  = px_area.w() * BPP;
+
+    for (int y = px_area.p0.y; y <= px_area.p1.y; ++y)
+    {
+        const int OFFSET = y * PITCH + px_area.p0.x * BPP;
+
+        memcpy(dst + OFFSET, src + OFFSET, ROW_NR_BYTES);
+    }
+}
+
+//Copies an area of pixels laid out like the screen surface to the screen texture
+void upload_px_area(const Uint8* const px, const Rect& px_area)
+{
+    const SDL_Rect sdl_rect = {px_area.p0.x, px_area.p0.y, px_area.w(), px_area.h()};
+
+    const int PITCH = scr_srf_->pitch;
+
+    SDL_UpdateTexture(scr_texture_, &sdl_rect,
+                      px + px_area.p0.y * PITCH + px_area.p0.x * scr_srf_->format->BytesPerPixel,
+                      PITCH);
+}
+
+void present_scr_texture()
+{
+    SDL_RenderCopy(sdl_renderer_, scr_texture_, nullptr, nullptr);
+    SDL_RenderPresent(sdl_renderer_);
+}
+
+//True if called by the game thread while the main thread owns the window
+bool is_window_on_other_thread()
+{
+    return is_present_loop_running_ && !sdl_wrapper::is_main_thread();
+}
+
+//Runs a task touching the window on the main thread, and waits until it is done
+void run_window_task(void (*task)())
+{
+    SDL_LockMutex(frame_mutex_);
+
+    window_task_ = task;
+
+    SDL_CondBroadcast(frame_cond_);
+
+    while (window_task_)
+    {
+        SDL_CondWait(frame_cond_, frame_mutex_);
+    }
+
+    SDL_UnlockMutex(frame_mutex_);
+}
+
 } //Namespace
 
 void init()
 {
+    if (is_window_on_other_thread())
+    {
+        run_window_task(init);
+        return;
+    }
+
     TRACE_FUNC_BEGIN;
     cleanup();
 
@@ -470,16 +904,24 @@ void init()
         assert(false);
     }
 
-    load_font();
+    published_px_.assign(scr_srf_->pitch * scr_srf_->h, 0);
+
+    is_frame_published_ = false;
+    is_published_dirty_ = false;
+
+    //Nothing is retained on the new screen, and all of it must be copied to the window
+    is_char_lines_retained_ = false;
+    is_log_retained_        = false;
+
+    on_scr_drawn();
+
+    load_px_data();
 
     if (config::is_tiles_mode())
     {
-        load_tiles();
         load_main_menu_logo();
     }
 
-    load_contour(config::is_tiles_mode() ? tile_px_data_ : font_px_data_);
-
     TRACE_FUNC_END;
 }
 
@@ -487,6 +929,22 @@ void cleanup()
 {
     TRACE_FUNC_BEGIN;
 
+    //The window is also cleaned up when it is made again, while the present loop runs
+    if (!is_present_loop_running_)
+    {
+        if (frame_cond_)
+        {
+            SDL_DestroyCond(frame_cond_);
+            frame_cond_ = nullptr;
+        }
+
+        if (frame_mutex_)
+        {
+            SDL_DestroyMutex(frame_mutex_);
+            frame_mutex_ = nullptr;
+        }
+    }
+
     if (sdl_renderer_)
     {
         SDL_DestroyRenderer(sdl_renderer_);
@@ -522,6 +980,12 @@ void cleanup()
 
 void on_toggle_fullscreen()
 {
+    if (is_window_on_other_thread())
+    {
+        run_window_task(on_toggle_fullscreen);
+        return;
+    }
+
     if (config::is_fullscreen())
     {
         SDL_SetWindowFullscreen(sdl_window_, SDL_WINDOW_FULLSCREEN_DESKTOP);
@@ -536,12 +1000,173 @@ void on_toggle_fullscreen()
 
 void update_screen()
 {
-    if (is_inited())
+    if (!is_inited())
+    {
+        return;
+    }
+
+    const Rect changed_area = clip_to_scr(dirty_px_area_);
+
+    const bool IS_DIRTY = is_scr_dirty_ &&
+                          changed_area.p0.x <= changed_area.p1.x &&
+                          changed_area.p0.y <= changed_area.p1.y;
+
+    is_scr_dirty_ = false;
+
+    if (!is_window_on_other_thread())
+    {
+        if (IS_DIRTY)
+        {
+            upload_px_area((const Uint8*)scr_srf_->pixels, changed_area);
+        }
+
+        present_scr_texture();
+        return;
+    }
+
+    //Publish the frame - if the previous frame has not been presented yet, it is replaced
+    //by this one (the changed areas are merged)
+    SDL_LockMutex(frame_mutex_);
+
+    if (IS_DIRTY)
     {
-        SDL_UpdateTexture(scr_texture_, nullptr, scr_srf_->pixels, scr_srf_->pitch);
-        SDL_RenderCopy(sdl_renderer_, scr_texture_, nullptr, nullptr);
-        SDL_RenderPresent(sdl_renderer_);
+        copy_px_area((const Uint8*)scr_srf_->pixels, published_px_.data(), changed_area);
+
+        if (is_published_dirty_)
+        {
+            Rect& a = published_px_area_;
+
+            a.p0.x = std::min(a.p0.x, changed_area.p0.x);
+            a.p0.y = std::min(a.p0.y, changed_area.p0.y);
+            a.p1.x = std::max(a.p1.x, changed_area.p1.x);
+            a.p1.y = std::max(a.p1.y, changed_area.p1.y);
+        }
+        else
+        {
+            published_px_area_  = changed_area;
+            is_published_dirty_ = true;
+        }
     }
+
+    is_frame_published_ = true;
+
+    SDL_CondBroadcast(frame_cond_);
+
+    SDL_UnlockMutex(frame_mutex_);
+}
+
+bool start_present_loop()
+{
+    assert(sdl_wrapper::is_main_thread());
+    assert(!is_present_loop_running_);
+
+    if (!frame_mutex_)
+    {
+        frame_mutex_ = SDL_CreateMutex();
+    }
+
+    if (!frame_cond_)
+    {
+        frame_cond_ = SDL_CreateCond();
+    }
+
+    if (!is_inited() || !frame_mutex_ || !frame_cond_)
+    {
+        return false;
+    }
+
+    is_frame_published_         = false;
+    is_published_dirty_         = false;
+    window_task_                = nullptr;
+    is_present_loop_running_    = true;
+
+    return true;
+}
+
+void run_present_loop()
+{
+    assert(sdl_wrapper::is_main_thread());
+
+    //How often the window events are pumped while there is nothing to present
+    const Uint32 PUMP_INTERVAL_MS = 5;
+
+    //Text input is kept enabled while the game runs on the other thread
+    SDL_StartTextInput();
+
+    SDL_LockMutex(frame_mutex_);
+
+    while (is_present_loop_running_)
+    {
+        if (is_frame_published_)
+        {
+            //The frame is uploaded while holding the lock, but presented without it, so
+            //that the game can publish the next frame while this one is presented
+            if (is_published_dirty_)
+            {
+                upload_px_area(published_px_.data(), published_px_area_);
+            }
+
+            is_frame_published_ = false;
+            is_published_dirty_ = false;
+
+            SDL_UnlockMutex(frame_mutex_);
+
+            present_scr_texture();
+
+            SDL_PumpEvents();
+
+            SDL_LockMutex(frame_mutex_);
+        }
+        else if (window_task_)
+        {
+            //The game thread waits until the task is done, so nothing is drawn or published
+            //meanwhile (a frame published before the task is presented first)
+            void (*task)() = window_task_;
+
+            SDL_UnlockMutex(frame_mutex_);
+
+            task();
+
+            SDL_LockMutex(frame_mutex_);
+
+            window_task_ = nullptr;
+
+            SDL_CondBroadcast(frame_cond_);
+        }
+        else
+        {
+            SDL_UnlockMutex(frame_mutex_);
+
+            SDL_PumpEvents();
+
+            SDL_LockMutex(frame_mutex_);
+
+            if (is_present_loop_running_ && !is_frame_published_ && !window_task_)
+            {
+                SDL_CondWaitTimeout(frame_cond_, frame_mutex_, PUMP_INTERVAL_MS);
+            }
+        }
+    }
+
+    SDL_UnlockMutex(frame_mutex_);
+
+    SDL_StopTextInput();
+}
+
+void stop_present_loop()
+{
+    if (!frame_mutex_)
+    {
+        return;
+    }
+
+    SDL_LockMutex(frame_mutex_);
+
+    is_present_loop_running_ = false;
+
+    SDL_CondBroadcast(frame_cond_);
+
+    SDL_UnlockMutex(frame_mutex_);
 }
 
 void clear_screen()
@@ -549,6 +1174,8 @@ void clear_screen()
     if (is_inited())
     {
         SDL_FillRect(scr_srf_, nullptr, SDL_MapRGB(scr_srf_->format, 0, 0, 0));
+
+        on_scr_drawn();
     }
 }
 
@@ -902,6 +1529,8 @@ int draw_text_centered(const std::string& str, const Panel panel, const Pos& pos
     SDL_FillRect(scr_srf_, &sdl_rect,
                  SDL_MapRGB(scr_srf_->format, bg_clr.r, bg_clr.g, bg_clr.b));
 
+    on_px_area_drawn(px_pos, Pos(W_TOT_PIXEL, cell_dims.y));
+
     for (int i = 0; i < LEN; ++i)
     {
         if (px_pos.x < 0 || px_pos.x >= config::scr_px_w())
@@ -991,6 +1620,8 @@ void draw_rectangle_solid(const Pos& px_pos, const Pos& px_dims, const Clr& clr)
         };
 
         SDL_FillRect(scr_srf_, &sdl_rect, SDL_MapRGB(scr_srf_->format, clr.r, clr.g, clr.b));
+
+        on_px_area_drawn(px_pos, px_dims);
     }
 }
 
@@ -1122,7 +1753,8 @@ void draw_map_and_interface(const bool SHOULD_UPDATE_SCREEN)
 {
     if (is_inited())
     {
-        clear_screen();
+        //The map is always drawn again, the other panels only if they have changed
+        cover_panel(Panel::map);
 
         draw_map();
 
@@ -1137,7 +1769,57 @@ void draw_map_and_interface(const bool SHOULD_UPDATE_SCREEN)
     }
 }
 
-void draw_map()
+bool is_panel_retained(const Panel panel)
+{
+    switch (panel)
+    {
+    case Panel::char_lines:
+        return is_char_lines_retained_;
+
+    case Panel::log:
+        return is_log_retained_;
+
+    case Panel::screen:
+    case Panel::map:
+        break;
+    }
+
+    return false;
+}
+
+void begin_retained_panel(const Panel panel)
+{
+    assert(panel == Panel::char_lines || panel == Panel::log);
+
+    if (is_inited())
+    {
+        assert(!is_drawing_retained_);
+
+        is_drawing_retained_    = true;
+        retained_panel_drawn_   = panel;
+    }
+}
+
+void end_retained_panel()
+{
+    if (is_inited())
+    {
+        assert(is_drawing_retained_);
+
+        is_drawing_retained_ = false;
+
+        if (retained_panel_drawn_ == Panel::char_lines)
+        {
+            is_char_lines_retained_ = true;
+        }
+        else
+        {
+            is_log_retained_ = true;
+        }
+    }
+}
+
+void update_seen_cells_render_data()
 {
     if (!is_inited())
     {
@@ -1146,8 +1828,6 @@ void draw_map()
 
     Cell_render_data* cur_render_data = nullptr;
 
-    const bool IS_TILES = config::is_tiles_mode();
-
     //---------------- INSERT RIGIDS AND BLOOD INTO ARRAY
     for (int x = 0; x < MAP_W; ++x)
     {
@@ -1244,6 +1924,39 @@ void draw_map()
             }
         }
     }
+}
+
+void draw_map()
+{
+    PROFILE_SCOPE("render::draw_map");
+
+    if (!is_inited())
+    {
+        return;
+    }
+
+    update_seen_cells_render_data();
+
+    Cell_render_data* cur_render_data = nullptr;
+
+    const bool IS_TILES = config::is_tiles_mode();
+
+    //---------------- INSERT SMOKE INTO ARRAY
+    const auto& smoke_data = feature_data::data(Feature_id::smoke);
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            if (map::cells[x][y].is_seen_by_player && fire_smoke::is_smoke_at(Pos(x, y)))
+            {
+                cur_render_data = &render_array[x][y];
+                cur_render_data->clr   = clr_gray;
+                cur_render_data->tile  = smoke_data.tile;
+                cur_render_data->glyph = smoke_data.glyph;
+            }
+        }
+    }
 
     //---------------- INSERT MOBILE FEATURES INTO ARRAY
     for (auto* mob : game_time::mobs_)
@@ -1347,8 +2060,8 @@ void draw_map()
                 bool is_aware_of_mon_here               = tmp_render_data.is_aware_of_mon_here;
 
                 //Set render array and the temporary render data to the remembered cell
-                render_array[x][y]                      = cell.player_visual_memory;
-                tmp_render_data                         = cell.player_visual_memory;
+                render_array[x][y]                      = player_visual_memory[x][y];
+                tmp_render_data                         = player_visual_memory[x][y];
 
                 tmp_render_data.is_aware_of_mon_here    = is_aware_of_mon_here;
 
@@ -1367,11 +2080,12 @@ void draw_map()
                     !tmp_render_data.is_living_actor_seen_here &&
                     !tmp_render_data.is_aware_of_mon_here)
                 {
-                    const auto tile_seen    = render_array_no_actors[x][y].tile;
-                    const auto tile_mem     = cell.player_visual_memory.tile;
-                    const bool IS_TILE_WALL = cell.is_seen_by_player ?
-                                              Wall::is_tile_any_wall_top(tile_seen) :
-                                              Wall::is_tile_any_wall_top(tile_mem);
+                    //The visual memory is only read for cells not currently seen
+                    const auto tile         = cell.is_seen_by_player ?
+                                              render_array_no_actors[x][y].tile :
+                                              player_visual_memory[x][y].tile;
+
+                    const bool IS_TILE_WALL = Wall::is_tile_any_wall_top(tile);
 
                     if (IS_TILE_WALL)
                     {
@@ -1393,26 +2107,19 @@ void draw_map()
                                 const bool IS_SEEN_BELOW  =
                                     map::cells[x][y + 1].is_seen_by_player;
 
-                                const auto tile_below_seen  =
-                                    render_array_no_actors[x][y + 1].tile;
-
-                                const auto tile_below_mem   =
-                                    map::cells[x][y + 1].player_visual_memory.tile;
+                                const auto tile_below =
+                                    IS_SEEN_BELOW ?
+                                    render_array_no_actors[x][y + 1].tile :
+                                    player_visual_memory[x][y + 1].tile;
 
                                 const bool TILE_BELOW_IS_WALL_FRONT =
-                                    IS_SEEN_BELOW ?
-                                    Wall::is_tile_any_wall_front(tile_below_seen) :
-                                    Wall::is_tile_any_wall_front(tile_below_mem);
+                                    Wall::is_tile_any_wall_front(tile_below);
 
                                 const bool TILE_BELOW_IS_WALL_TOP =
-                                    IS_SEEN_BELOW ?
-                                    Wall::is_tile_any_wall_top(tile_below_seen) :
-                                    Wall::is_tile_any_wall_top(tile_below_mem);
+                                    Wall::is_tile_any_wall_top(tile_below);
 
                                 bool tile_below_is_revealed_door =
-                                    IS_SEEN_BELOW ?
-                                    Door::is_tile_any_door(tile_below_seen) :
-                                    Door::is_tile_any_door(tile_below_mem);
+                                    Door::is_tile_any_door(tile_below);
 
                                 if (
                                     TILE_BELOW_IS_WALL_FRONT  ||
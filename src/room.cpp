@@ -1,6 +1,7 @@
 #include "room.hpp"
 
 #include <algorithm>
+#include <climits>
 
 #include "init.hpp"
 #include "utils.hpp"
@@ -20,7 +21,7 @@ using namespace std;
 namespace
 {
 
-vector<Room_type> room_bucket_;
+thread_local vector<Room_type> room_bucket_;
 
 void add_to_room_bucket(const Room_type type, const size_t NR)
 {
@@ -91,7 +92,7 @@ void init_room_bucket()
         add_to_room_bucket(Room_type::forest,   rnd::range(1, 4));
     }
 
-    std::random_shuffle(begin(room_bucket_), end(room_bucket_));
+    rnd::shuffle(room_bucket_);
 
     TRACE_FUNC_END;
 }
@@ -1009,30 +1010,24 @@ void Forest_room::on_post_connect_hook(bool door_proposals[MAP_W][MAP_H])
         }
     }
 
-    random_shuffle(begin(tree_pos_bucket), end(tree_pos_bucket));
+    rnd::shuffle(tree_pos_bucket);
 
     int nr_trees_placed = 0;
 
     const int TREE_ONE_IN_N = rnd::range(2, 5);
 
+    map_parse::Map_connectivity connectivity(blocked);
+
     while (!tree_pos_bucket.empty())
     {
         const Pos p = tree_pos_bucket.back();
         tree_pos_bucket.pop_back();
 
-        if (rnd::one_in(TREE_ONE_IN_N))
+        if (rnd::one_in(TREE_ONE_IN_N) && connectivity.is_connected_if_blocked(p))
         {
-            blocked[p.x][p.y] = true;
-
-            if (map_parse::is_map_connected(blocked))
-            {
-                map::put(new Tree(p));
-                ++nr_trees_placed;
-            }
-            else
-            {
-                blocked[p.x][p.y] = false;
-            }
+            map::put(new Tree(p));
+            connectivity.block(p);
+            ++nr_trees_placed;
         }
     }
 }
@@ -1384,7 +1379,7 @@ void River_room::on_pre_connect(bool door_proposals[MAP_W][MAP_H])
 
     vector<int> coordinates(IS_HOR ? MAP_W : MAP_H);
     iota(begin(coordinates), end(coordinates), 0);
-    random_shuffle(coordinates.begin(), coordinates.end());
+    rnd::shuffle(coordinates);
 
     vector<int> c_built;
 
@@ -1524,7 +1519,7 @@ void River_room::on_pre_connect(bool door_proposals[MAP_W][MAP_H])
 
     if (c_built.empty())
     {
-        map_gen::is_map_valid = false;
+        map_gen::reject_map(Map_gen_reject::river_not_bridged);
     }
     else //map is valid (at least one bridge was built)
     {
@@ -17,6 +17,7 @@
 #include "game_time.hpp"
 #include "player_spells_handling.hpp"
 #include "item_jewelry.hpp"
+#include "profiler.hpp"
 
 using namespace std;
 
@@ -115,15 +116,24 @@ void read_file(vector<string>& lines)
 
 void save()
 {
+    PROFILE_SCOPE("save_handling::save");
+
     vector<string> lines;
     collect_lines_from_game(lines);
     write_file(lines);
+
+    PROFILE_COUNT("save_handling::nr_lines_saved", lines.size());
 }
 
 void load()
 {
+    PROFILE_SCOPE("save_handling::load");
+
     vector<string> lines;
     read_file(lines);
+
+    PROFILE_COUNT("save_handling::nr_lines_loaded", lines.size());
+
     setup_game_from_lines(lines);
 }
 
@@ -19,6 +19,8 @@ namespace
 
 bool is_inited = false;
 
+SDL_threadID main_thread_id_ = 0;
+
 }
 
 void init()
@@ -27,6 +29,8 @@ void init()
 
     is_inited = true;
 
+    main_thread_id_ = SDL_ThreadID();
+
     if (SDL_Init(SDL_INIT_EVERYTHING) == -1)
     {
         TRACE << "Failed to init SDL" << endl;
@@ -68,7 +72,7 @@ void sleep(const Uint32 DURATION)
 {
     if (is_inited && !config::is_bot_playing())
     {
-        if (DURATION == 1)
+        if (DURATION == 1 || !is_main_thread())
         {
             SDL_Delay(DURATION);
         }
@@ -81,4 +85,9 @@ void sleep(const Uint32 DURATION)
     }
 }
 
+bool is_main_thread()
+{
+    return SDL_ThreadID() == main_thread_id_;
+}
+
 } //Sdl_wrapper
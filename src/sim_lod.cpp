@@ -0,0 +1,57 @@
+#include "sim_lod.hpp"
+
+#include "init.hpp"
+#include "actor_mon.hpp"
+#include "actor_player.hpp"
+#include "game_time.hpp"
+#include "map.hpp"
+#include "utils.hpp"
+
+namespace sim_lod
+{
+
+bool is_low_detail(const Mon& mon)
+{
+    if (
+        mon.nr_turns_full_detail_ > 0           ||
+        mon.aware_counter_ > 0                  ||
+        !mon.is_alive()                         ||
+        mon.is_actor_my_leader(map::player)     ||
+        mon.has_prop(Prop_id::conflict))
+    {
+        return false;
+    }
+
+    for (const Actor* const actor : game_time::actors_)
+    {
+        const bool IS_PLAYER_SIDE = actor->is_player() ||
+                                    actor->is_actor_my_leader(map::player);
+
+        if (
+            IS_PLAYER_SIDE                                      &&
+            actor->is_alive()                                   &&
+            utils::king_dist(actor->pos, mon.pos) <= WAKE_DIST)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void wake_near(const Pos& p)
+{
+    for (Actor* const actor : game_time::actors_)
+    {
+        //NOTE: This is also called when the player is made (before map::player is set), so
+        //the player is identified by the actor id here
+        if (
+            actor->data().id != Actor_id::player   &&
+            utils::king_dist(actor->pos, p) <= WAKE_DIST)
+        {
+            static_cast<Mon*>(actor)->nr_turns_full_detail_ = NR_TURNS_WOKEN;
+        }
+    }
+}
+
+} //sim_lod
@@ -10,6 +10,7 @@
 #include "game_time.hpp"
 #include "map_parsing.hpp"
 #include "utils.hpp"
+#include "profiler.hpp"
 
 using namespace std;
 
@@ -37,7 +38,7 @@ namespace snd_emit
 namespace
 {
 
-int nr_snd_msg_printed_cur_turn_;
+thread_local int nr_snd_msg_printed_cur_turn_;
 
 bool is_snd_heard_at_range(const int RANGE, const Snd& snd)
 {
@@ -53,6 +54,8 @@ void reset_nr_snd_msg_printed_cur_turn()
 
 void emit_snd(Snd snd)
 {
+    PROFILE_SCOPE("snd_emit::emit_snd");
+
     bool blocked[MAP_W][MAP_H];
 
     for (int x = 0; x < MAP_W; ++x)
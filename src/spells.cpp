@@ -743,6 +743,7 @@ Spell_effect_noticed Spell_det_items::cast_impl(Actor* const caster) const
             {
                 map::cells[x][y].is_seen_by_player = true;
                 map::cells[x][y].is_explored     = true;
+                map::player->mark_unmemorized(Pos(x, y));
                 items_revealed_cells.push_back(Pos(x, y));
             }
         }
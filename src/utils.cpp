@@ -2,11 +2,12 @@
 
 #include <algorithm>
 #include <vector>
+#include <chrono>
 #include <cassert>
+#include <climits>
 
 #include "converters.hpp"
 #include "game_time.hpp"
-#include "mersenne_twister.hpp"
 #include "actor.hpp"
 #include "feature_mob.hpp"
 
@@ -16,7 +17,33 @@ namespace rnd
 namespace
 {
 
-MTRand mt_rand;
+struct Streams
+{
+    Streams()
+    {
+        //Mix in the address of this (thread local) object, so that threads started at the
+        //same time still get different sequences
+        const uint64_t TIME = std::chrono::high_resolution_clock::now().time_since_epoch().count();
+
+        set_seed(TIME ^ uint64_t(uintptr_t(this)));
+    }
+
+    void set_seed(const uint64_t SEED)
+    {
+        Rng rng(SEED);
+
+        for (Rng& stream : rngs)
+        {
+            stream = rng;
+            rng.jump();
+        }
+    }
+
+    Rng rngs[int(Stream::END)];
+};
+
+thread_local Streams    streams_;
+thread_local Stream     cur_stream_ = Stream::cmn;
 
 int roll(const int ROLLS, const int SIDES)
 {
@@ -30,11 +57,13 @@ int roll(const int ROLLS, const int SIDES)
         return ROLLS * SIDES;
     }
 
+    Rng& rng = streams_.rngs[int(cur_stream_)];
+
     int result = 0;
 
     for (int i = 0; i < ROLLS; ++i)
     {
-        result += mt_rand.randInt(SIDES - 1) + 1;
+        result += rng.rand_int(SIDES) + 1;
     }
 
     return result;
@@ -42,9 +71,29 @@ int roll(const int ROLLS, const int SIDES)
 
 } //Namespace
 
+Stream_scope::Stream_scope(const Stream stream) :
+    prev_stream_(cur_stream_)
+{
+    assert(stream != Stream::END);
+
+    cur_stream_ = stream;
+}
+
+Stream_scope::~Stream_scope()
+{
+    cur_stream_ = prev_stream_;
+}
+
 void seed(const unsigned long val)
 {
-    mt_rand = MTRand(val);
+    streams_.set_seed(val);
+}
+
+Rng& stream_rng(const Stream stream)
+{
+    assert(stream != Stream::END);
+
+    return streams_.rngs[int(stream)];
 }
 
 int dice(const int ROLLS, const int SIDES)
@@ -14,6 +14,7 @@
 #include "actor_player.hpp"
 #include "throwing.hpp"
 #include "item_factory.hpp"
+#include "item_potion.hpp"
 #include "text_format.hpp"
 #include "actor_factory.hpp"
 #include "actor_Mon.hpp"
@@ -31,8 +32,15 @@
 #include "item_Device.hpp"
 #include "feature_Rigid.hpp"
 #include "feature_Trap.hpp"
+#include "feature_door.hpp"
 #include "drop.hpp"
 #include "map_Travel.hpp"
+#include "fire_smoke.hpp"
+#include "alloc_tracking.hpp"
+#include "game_time.hpp"
+#include "msg_log.hpp"
+#include "perception.hpp"
+#include "sim_lod.hpp"
 
 struct Basic_fixture
 {
@@ -93,6 +101,63 @@ TEST(roll_dice)
     CHECK(val >= -1 && val <= 1);
 }
 
+TEST(rnd_streams)
+{
+    //Same seed, same sequence
+    Rng a(1234);
+    Rng b(1234);
+
+    for (int i = 0; i < 100; ++i)
+    {
+        CHECK_EQUAL(a.next(), b.next());
+    }
+
+    for (int i = 0; i < 1000; ++i)
+    {
+        CHECK(a.rand_int(6) < 6);
+    }
+
+    //Rolls in one stream should not affect the rolls in another stream
+    std::vector<int> mapgen_rolls;
+
+    rnd::seed(1234);
+
+    {
+        rnd::Stream_scope rnd_scope(rnd::Stream::mapgen);
+
+        for (int i = 0; i < 10; ++i)
+        {
+            mapgen_rolls.push_back(rnd::range(0, 1000000));
+        }
+    }
+
+    rnd::seed(1234);
+
+    for (int i = 0; i < 10; ++i)
+    {
+        rnd::Stream_scope rnd_scope(rnd::Stream::cosmetic);
+
+        rnd::dice(1, 100);
+
+        {
+            rnd::Stream_scope rnd_scope_inner(rnd::Stream::mapgen);
+
+            CHECK_EQUAL(mapgen_rolls[i], rnd::range(0, 1000000));
+        }
+
+        rnd::percent();
+    }
+
+    //Each stream is the previous stream jumped ahead
+    rnd::seed(1234);
+
+    Rng jumped(1234);
+
+    jumped.jump();
+
+    CHECK_EQUAL(jumped.next(), rnd::stream_rng(rnd::Stream::mapgen).next());
+}
+
 TEST(constrain_val_in_range)
 {
     int val = constr_in_range(5, 9, 10);
@@ -317,33 +382,34 @@ TEST_FIXTURE(Basic_fixture, line_calculation)
     CHECK(line[2] == Pos(2, 0));
 
     //Test precalculated FOV line offsets
-    const std::vector<Pos>* delta_line = line_calc::fov_delta_line(Pos(3, 3), FOV_STD_RADI_DB);
+    const line_calc::Delta_line* delta_line =
+        line_calc::fov_delta_line(Pos(3, 3), FOV_STD_RADI_DB);
     CHECK(delta_line->size() == 4);
-    CHECK(delta_line->at(0) == Pos(0, 0));
-    CHECK(delta_line->at(1) == Pos(1, 1));
-    CHECK(delta_line->at(2) == Pos(2, 2));
-    CHECK(delta_line->at(3) == Pos(3, 3));
+    CHECK((*delta_line)[0] == Pos(0, 0));
+    CHECK((*delta_line)[1] == Pos(1, 1));
+    CHECK((*delta_line)[2] == Pos(2, 2));
+    CHECK((*delta_line)[3] == Pos(3, 3));
 
     delta_line = line_calc::fov_delta_line(Pos(-3, 3), FOV_STD_RADI_DB);
     CHECK(delta_line->size() == 4);
-    CHECK(delta_line->at(0) == Pos(0, 0));
-    CHECK(delta_line->at(1) == Pos(-1, 1));
-    CHECK(delta_line->at(2) == Pos(-2, 2));
-    CHECK(delta_line->at(3) == Pos(-3, 3));
+    CHECK((*delta_line)[0] == Pos(0, 0));
+    CHECK((*delta_line)[1] == Pos(-1, 1));
+    CHECK((*delta_line)[2] == Pos(-2, 2));
+    CHECK((*delta_line)[3] == Pos(-3, 3));
 
     delta_line = line_calc::fov_delta_line(Pos(3, -3), FOV_STD_RADI_DB);
     CHECK(delta_line->size() == 4);
-    CHECK(delta_line->at(0) == Pos(0, 0));
-    CHECK(delta_line->at(1) == Pos(1, -1));
-    CHECK(delta_line->at(2) == Pos(2, -2));
-    CHECK(delta_line->at(3) == Pos(3, -3));
+    CHECK((*delta_line)[0] == Pos(0, 0));
+    CHECK((*delta_line)[1] == Pos(1, -1));
+    CHECK((*delta_line)[2] == Pos(2, -2));
+    CHECK((*delta_line)[3] == Pos(3, -3));
 
     delta_line = line_calc::fov_delta_line(Pos(-3, -3), FOV_STD_RADI_DB);
     CHECK(delta_line->size() == 4);
-    CHECK(delta_line->at(0) == Pos(0, 0));
-    CHECK(delta_line->at(1) == Pos(-1, -1));
-    CHECK(delta_line->at(2) == Pos(-2, -2));
-    CHECK(delta_line->at(3) == Pos(-3, -3));
+    CHECK((*delta_line)[0] == Pos(0, 0));
+    CHECK((*delta_line)[1] == Pos(-1, -1));
+    CHECK((*delta_line)[2] == Pos(-2, -2));
+    CHECK((*delta_line)[3] == Pos(-3, -3));
 
     //Check constraints for retrieving FOV offset lines
     //Delta > parameter max distance
@@ -404,6 +470,117 @@ TEST_FIXTURE(Basic_fixture, fov)
     CHECK(fov[X - R + 1][Y + R - 1].is_blocked_hard);
 }
 
+TEST_FIXTURE(Basic_fixture, player_visual_memory)
+{
+    //Open a small room around the player, the rest of the map is wall
+    for (int x = 10; x <= 14; ++x)
+    {
+        for (int y = 5; y <= 9; ++y)
+        {
+            map::put(new Floor(Pos(x, y)));
+        }
+    }
+
+    map::player->pos = Pos(12, 7);
+
+    map::player->update_fov();
+
+    const auto& seen_cells = map::player->seen_cells();
+
+    CHECK(!seen_cells.empty());
+
+    int nr_seen = 0;
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            if (map::cells[x][y].is_seen_by_player)
+            {
+                ++nr_seen;
+            }
+        }
+    }
+
+    CHECK_EQUAL(nr_seen, int(seen_cells.size()));
+
+    //Only seen cells should be copied to the memory
+    const Pos seen_pos(13, 7);
+    const Pos unseen_pos(30, 15);
+
+    CHECK(map::cells[seen_pos.x][seen_pos.y].is_seen_by_player);
+    CHECK(!map::cells[unseen_pos.x][unseen_pos.y].is_seen_by_player);
+
+    render::render_array_no_actors[seen_pos.x][seen_pos.y].glyph     = 'a';
+    render::render_array_no_actors[unseen_pos.x][unseen_pos.y].glyph = 'b';
+
+    map::cpy_render_array_to_visual_memory();
+
+    CHECK_EQUAL('a', render::player_visual_memory[seen_pos.x][seen_pos.y].glyph);
+    CHECK(render::player_visual_memory[unseen_pos.x][unseen_pos.y].glyph != 'b');
+
+    CHECK(map::player->unmemorized_cells().empty());
+
+    //Cells seen at an earlier FOV update in the same turn (e.g. before teleporting) are
+    //also copied
+    for (int x = 30; x <= 34; ++x)
+    {
+        for (int y = 5; y <= 9; ++y)
+        {
+            map::put(new Floor(Pos(x, y)));
+        }
+    }
+
+    const Pos first_pos(11, 6);
+    const Pos second_pos(31, 6);
+
+    map::player->update_fov();
+
+    render::render_array_no_actors[first_pos.x][first_pos.y].glyph = 'c';
+
+    map::player->pos = Pos(32, 7);
+
+    map::player->update_fov();
+
+    CHECK(!map::cells[first_pos.x][first_pos.y].is_seen_by_player);
+
+    render::render_array_no_actors[second_pos.x][second_pos.y].glyph = 'd';
+
+    map::cpy_render_array_to_visual_memory();
+
+    CHECK_EQUAL('c', render::player_visual_memory[first_pos.x][first_pos.y].glyph);
+    CHECK_EQUAL('d', render::player_visual_memory[second_pos.x][second_pos.y].glyph);
+}
+
+TEST_FIXTURE(Basic_fixture, clairvoyance_is_remembered)
+{
+    //A long lit corridor, the far end is outside the player's FOV
+    for (int x = 1; x <= 40; ++x)
+    {
+        map::put(new Floor(Pos(x, 1)));
+    }
+
+    const Pos far_pos(35, 1);
+
+    map::player->update_fov();
+
+    CHECK(!map::cells[far_pos.x][far_pos.y].is_seen_by_player);
+
+    //Rendering is not initialized, so stand in for drawing the revealed cell
+    render::render_array_no_actors[far_pos.x][far_pos.y].glyph = 'x';
+
+    Item* const potion = item_factory::mk(Item_id::potion_clairv);
+
+    //Quaffing runs the next tick, where the visual memory is updated
+    static_cast<Potion*>(potion)->quaff(*map::player);
+
+    delete potion;
+
+    CHECK(map::cells[far_pos.x][far_pos.y].is_explored);
+    CHECK(!map::cells[far_pos.x][far_pos.y].is_seen_by_player);
+    CHECK_EQUAL('x', render::player_visual_memory[far_pos.x][far_pos.y].glyph);
+}
+
 TEST_FIXTURE(Basic_fixture, throw_items)
 {
     //-----------------------------------------------------------------
@@ -537,6 +714,307 @@ TEST_FIXTURE(Basic_fixture, explosions)
     CHECK(map::cells[x    ][y + 1].rigid->id() == Feature_id::wall);
 }
 
+TEST_FIXTURE(Basic_fixture, fire_and_smoke)
+{
+    rnd::seed(1);
+
+    const Pos p(10, 10);
+
+    map::put(new Floor(p));
+
+    //Smoke blocks LOS, and lasts for the given number of turns
+    fire_smoke::put_smoke(p, 2);
+    fire_smoke::put_smoke(p, 1); //Shorter duration - should not override
+
+    CHECK(fire_smoke::is_smoke_at(p));
+    CHECK(cell_check::Blocks_los().check(map::cells[p.x][p.y]));
+
+    fire_smoke::on_new_turn();
+    CHECK(fire_smoke::is_smoke_at(p));
+
+    fire_smoke::on_new_turn();
+    CHECK(!fire_smoke::is_smoke_at(p));
+    CHECK(!cell_check::Blocks_los().check(map::cells[p.x][p.y]));
+
+    //Fire spreads at most one step per turn, regardless of the order the cells are visited
+    //(the grass is kept away from the player)
+    for (int x = 3; x < MAP_W - 1; ++x)
+    {
+        for (int y = 1; y < MAP_H - 1; ++y)
+        {
+            map::put(new Grass(Pos(x, y)));
+        }
+    }
+
+    const Pos origin(MAP_W_HALF, MAP_H_HALF);
+
+    map::cells[origin.x][origin.y].rigid->hit(Dmg_type::fire, Dmg_method::elemental);
+
+    CHECK(map::cells[origin.x][origin.y].rigid->burn_state() == Burn_state::burning);
+
+    bool has_spread = false;
+
+    for (int turn = 1; turn <= 200; ++turn)
+    {
+        fire_smoke::on_new_turn();
+
+        for (int x = 0; x < MAP_W; ++x)
+        {
+            for (int y = 0; y < MAP_H; ++y)
+            {
+                const Pos cur(x, y);
+
+                if (map::cells[x][y].rigid->burn_state() != Burn_state::not_burned)
+                {
+                    CHECK(utils::king_dist(origin, cur) <= turn);
+
+                    if (cur != origin) {has_spread = true;}
+                }
+            }
+        }
+    }
+
+    CHECK(has_spread);
+}
+
+#ifdef ALLOC_TRACKING
+TEST_FIXTURE(Basic_fixture, alloc_tracking)
+{
+    alloc_tracking::reset_period();
+
+    const auto& stats = alloc_tracking::stats(Alloc_cat::item);
+
+    const long long NR_LIVE_BEFORE = stats.nr_live;
+
+    Item* const item1 = item_factory::mk(Item_id::dynamite);
+    Item* const item2 = item_factory::mk(Item_id::dynamite);
+
+    CHECK_EQUAL(2, stats.nr_allocs);
+    CHECK_EQUAL(NR_LIVE_BEFORE + 2, stats.nr_live);
+    CHECK(stats.bytes_allocd >= 2 * (long long)sizeof(Item));
+
+    delete item1;
+    delete item2;
+
+    CHECK_EQUAL(2, stats.nr_frees);
+    CHECK_EQUAL(NR_LIVE_BEFORE, stats.nr_live);
+    CHECK_EQUAL(NR_LIVE_BEFORE + 2, stats.peak_nr_live);
+
+    //A new period keeps the live objects, but clears the counts
+    alloc_tracking::reset_period();
+
+    CHECK_EQUAL(0, stats.nr_allocs);
+    CHECK_EQUAL(NR_LIVE_BEFORE, stats.peak_nr_live);
+}
+#endif // ALLOC_TRACKING
+
+TEST_FIXTURE(Basic_fixture, actor_handles)
+{
+    for (int x = 1; x <= 5; ++x)
+    {
+        map::put(new Floor(Pos(x, 1)));
+    }
+
+    Actor* const mon0 = actor_factory::mk(Actor_id::rat, Pos(3, 1));
+    Actor* const mon1 = actor_factory::mk(Actor_id::rat, Pos(4, 1));
+    Actor* const mon2 = actor_factory::mk(Actor_id::rat, Pos(5, 1));
+
+    CHECK_EQUAL(4, int(game_time::actors_.size()));
+    CHECK(game_time::actors_[1] == mon0);
+    CHECK(game_time::actors_.get(mon1->handle) == mon1);
+
+    map::player->set_tgt(mon1);
+    CHECK(map::player->tgt() == mon1);
+
+    //Erasing an actor moves the last actor into its place
+    game_time::erase_actor_in_element(1);
+    CHECK_EQUAL(3, int(game_time::actors_.size()));
+    CHECK(game_time::actors_[1] == mon2);
+    CHECK(game_time::actors_[2] == mon1);
+    CHECK(game_time::actors_.get(mon2->handle) == mon2);
+    CHECK(map::player->tgt() == mon1);
+
+    //The target handle is stale when the actor is deleted, even if the slot is reused
+    game_time::erase_actor_in_element(2);
+    CHECK(!map::player->tgt());
+
+    Actor* const mon3 = actor_factory::mk(Actor_id::rat, Pos(4, 1));
+    CHECK(!map::player->tgt());
+    CHECK(game_time::actors_.get(mon3->handle) == mon3);
+
+    actor_factory::delete_all_mon();
+    CHECK_EQUAL(1, int(game_time::actors_.size()));
+    CHECK(game_time::actors_[0] == map::player);
+    CHECK(!game_time::actors_.get(mon3->handle));
+}
+
+TEST_FIXTURE(Basic_fixture, perception)
+{
+    for (int x = 1; x <= 8; ++x)
+    {
+        map::put(new Floor(Pos(x, 1)));
+        map::put(new Floor(Pos(x, 2)));
+    }
+
+    Mon* const hostile0 = static_cast<Mon*>(actor_factory::mk(Actor_id::rat, Pos(3, 1)));
+    Mon* const hostile1 = static_cast<Mon*>(actor_factory::mk(Actor_id::rat, Pos(5, 2)));
+    Mon* const ally     = static_cast<Mon*>(actor_factory::mk(Actor_id::rat, Pos(4, 1)));
+
+    ally->leader_ = map::player;
+
+    perception::invalidate();
+
+    //Monsters see the actors of the other faction, in the order of the actors vector
+    std::vector<Actor*> seen;
+
+    hostile0->seen_foes(seen);
+    CHECK_EQUAL(2, int(seen.size()));
+    CHECK(seen[0] == map::player);
+    CHECK(seen[1] == ally);
+
+    ally->seen_foes(seen);
+    CHECK_EQUAL(2, int(seen.size()));
+    CHECK(seen[0] == hostile0);
+    CHECK(seen[1] == hostile1);
+
+    //Actors which die are left out, without a new pass
+    hostile0->die(false, false, false);
+
+    ally->seen_foes(seen);
+    CHECK_EQUAL(1, int(seen.size()));
+    CHECK(seen[0] == hostile1);
+
+    //Adding an actor discards the results
+    Mon* const hostile2 = static_cast<Mon*>(actor_factory::mk(Actor_id::rat, Pos(6, 1)));
+
+    hostile2->seen_foes(seen);
+    CHECK_EQUAL(2, int(seen.size()));
+    CHECK(seen[1] == ally);
+}
+
+TEST_FIXTURE(Basic_fixture, sim_lod)
+{
+    const Pos far_pos(map::player->pos.x + sim_lod::WAKE_DIST + 1, 1);
+
+    Mon* const mon = static_cast<Mon*>(actor_factory::mk(Actor_id::rat, far_pos));
+
+    //Monsters are given full detail turns when they are spawned
+    CHECK(!sim_lod::is_low_detail(*mon));
+
+    mon->nr_turns_full_detail_ = 0;
+
+    CHECK(sim_lod::is_low_detail(*mon));
+
+    //Aware monsters always get full detail
+    mon->aware_counter_ = 1;
+    CHECK(!sim_lod::is_low_detail(*mon));
+    mon->aware_counter_ = 0;
+
+    //A monster spawned nearby wakes the monster
+    actor_factory::mk(Actor_id::rat, Pos(far_pos.x + 1, 1));
+
+    CHECK(!sim_lod::is_low_detail(*mon));
+
+    mon->nr_turns_full_detail_ = 0;
+
+    //Monsters near the player, or near the player's allies, get full detail
+    Mon* const ally = static_cast<Mon*>(actor_factory::mk(Actor_id::rat, map::player->pos));
+
+    ally->leader_ = map::player;
+
+    ally->pos = Pos(far_pos.x + sim_lod::WAKE_DIST, 1);
+
+    CHECK(!sim_lod::is_low_detail(*mon));
+
+    ally->pos = Pos(far_pos.x + sim_lod::WAKE_DIST + 1, 1);
+
+    CHECK(sim_lod::is_low_detail(*mon));
+
+    mon->pos = Pos(map::player->pos.x + sim_lod::WAKE_DIST, 1);
+
+    CHECK(!sim_lod::is_low_detail(*mon));
+}
+
+TEST_FIXTURE(Basic_fixture, travel_and_explore)
+{
+    //An L-shaped corridor
+    for (int x = 1; x <= 20; ++x)
+    {
+        map::put(new Floor(Pos(x, 1)));
+    }
+
+    for (int y = 2; y <= 10; ++y)
+    {
+        map::put(new Floor(Pos(20, y)));
+    }
+
+    map::player->update_fov();
+
+    CHECK(!map::cells[20][10].is_explored);
+
+    //Explore walks until everything reachable is explored
+    map::player->explore();
+
+    for (int i = 0; i < 100 && map::player->is_auto_moving(); ++i)
+    {
+        map::player->on_actor_turn();
+    }
+
+    CHECK(!map::player->is_auto_moving());
+    CHECK(map::cells[20][10].is_explored);
+
+    //Travel back to the start
+    map::player->travel_to(Pos(1, 1));
+
+    CHECK(map::player->is_auto_moving());
+
+    for (int i = 0; i < 100 && map::player->is_auto_moving(); ++i)
+    {
+        map::player->on_actor_turn();
+    }
+
+    CHECK(map::player->pos == Pos(1, 1));
+
+    //Unexplored positions cannot be travelled to
+    map::player->travel_to(Pos(30, 1));
+
+    CHECK(!map::player->is_auto_moving());
+}
+
+TEST_FIXTURE(Basic_fixture, travel_through_closed_door)
+{
+    //A corridor with a closed door in the middle
+    for (int x = 1; x <= 10; ++x)
+    {
+        map::put(new Floor(Pos(x, 1)));
+    }
+
+    const Pos door_pos(5, 1);
+
+    Door* const door = new Door(door_pos, new Wall(door_pos), Door_spawn_state::closed);
+
+    map::put(door);
+
+    for (int x = 1; x <= 10; ++x)
+    {
+        map::cells[x][1].is_explored = true;
+    }
+
+    map::player->travel_to(Pos(10, 1));
+
+    CHECK(map::player->is_auto_moving());
+
+    for (int i = 0; i < 100 && map::player->is_auto_moving(); ++i)
+    {
+        map::player->on_actor_turn();
+    }
+
+    //The door was opened on the way, without stopping the travel
+    CHECK(door->is_open());
+    CHECK(map::player->pos == Pos(10, 1));
+    CHECK(!map::player->is_auto_moving());
+}
+
 TEST_FIXTURE(Basic_fixture, monster_stuck_in_spider_web)
 {
     //-----------------------------------------------------------------
@@ -767,6 +1245,45 @@ TEST_FIXTURE(Basic_fixture, inventory_handling)
     }
 }
 
+TEST_FIXTURE(Basic_fixture, ability_vals_cache)
+{
+    Player& player = *map::player;
+
+    const Ability_vals& vals = player.data().ability_vals;
+
+    Inv_slot& body_slot = player.inv().slots_[size_t(Slot_id::body)];
+
+    delete body_slot.item;
+    body_slot.item = nullptr;
+
+    const int MELEE = vals.val(Ability_id::melee, true, player);
+
+    CHECK_EQUAL(MELEE, vals.val(Ability_id::melee, true, player));
+
+    //Traits
+    player_bon::pick_trait(Trait::adept_melee_fighter);
+    CHECK_EQUAL(MELEE + 10, vals.val(Ability_id::melee, true, player));
+
+    //Properties
+    player.prop_handler().try_add_prop(new Prop_blessed(Prop_turns::indefinite));
+    CHECK_EQUAL(MELEE + 20, vals.val(Ability_id::melee, true,  player));
+    CHECK_EQUAL(MELEE + 10, vals.val(Ability_id::melee, false, player));
+
+    player.prop_handler().end_prop(Prop_id::blessed);
+    CHECK_EQUAL(MELEE + 10, vals.val(Ability_id::melee, true, player));
+
+    //Equipped items
+    player.inv().put_in_slot(Slot_id::body, item_factory::mk(Item_id::armor_iron_suit));
+    CHECK_EQUAL(MELEE, vals.val(Ability_id::melee, true, player));
+
+    //Hit points ("perseverant" gives a bonus at low hit points)
+    player_bon::pick_trait(Trait::perseverant);
+    CHECK_EQUAL(MELEE, vals.val(Ability_id::melee, true, player));
+
+    player.hit(player.hp() - 1, Dmg_type::pure);
+    CHECK_EQUAL(MELEE + 30, vals.val(Ability_id::melee, true, player));
+}
+
 TEST_FIXTURE(Basic_fixture, saving_game)
 {
     //Item data
@@ -1121,6 +1638,84 @@ TEST_FIXTURE(Basic_fixture, path_finding)
     CHECK_EQUAL(10, int(path.size()));
 }
 
+TEST_FIXTURE(Basic_fixture, map_parse_cell_traits)
+{
+    const Pos door_pos(10, 5);
+    const Pos smoke_pos(5, 5);
+    const Pos floor_pos(6, 5);
+
+    map::put(new Floor(smoke_pos));
+    map::put(new Floor(floor_pos));
+
+    Door* const door = new Door(door_pos, new Wall(door_pos), Door_spawn_state::closed);
+
+    map::put(door);
+
+    fire_smoke::put_smoke(smoke_pos, 2);
+
+    bool blocked[MAP_W][MAP_H];
+
+    map_parse::run(cell_check::Blocks_los(), blocked);
+
+    CHECK(blocked[door_pos.x][door_pos.y]);
+    CHECK(blocked[smoke_pos.x][smoke_pos.y]);
+    CHECK(!blocked[floor_pos.x][floor_pos.y]);
+    CHECK(blocked[20][5]);
+
+    //Opening the door updates the traits of the cell
+    door->open(nullptr);
+
+    map_parse::run(cell_check::Blocks_los(), blocked);
+
+    CHECK(!blocked[door_pos.x][door_pos.y]);
+
+    //The map edge blocks everything
+    map::put(new Floor(Pos(0, 5)));
+
+    map_parse::run(cell_check::Blocks_move_cmn(false), blocked);
+
+    CHECK(blocked[0][5]);
+    CHECK(!blocked[smoke_pos.x][smoke_pos.y]);
+    CHECK(!blocked[door_pos.x][door_pos.y]);
+
+    //Appending only adds blocked cells
+    map_parse::run(cell_check::Blocks_los(), blocked, Map_parse_mode::append);
+
+    CHECK(blocked[smoke_pos.x][smoke_pos.y]);
+    CHECK(!blocked[floor_pos.x][floor_pos.y]);
+
+    //The lookups agree with the rigids, on a generated level
+    rnd::seed(1);
+
+    map::dlvl = 1;
+
+    while (!map_gen::mk_std_lvl()) {}
+
+    game_time::erase_all_mobs();
+
+    const Rect area(0, 0, 40, 10);
+
+    bool blocked_items[MAP_W][MAP_H];
+
+    map_parse::run(cell_check::Blocks_projectiles(), blocked, Map_parse_mode::overwrite, area);
+    map_parse::run(cell_check::Blocks_items(), blocked_items);
+
+    for (int x = 1; x < MAP_W - 1; ++x)
+    {
+        for (int y = 1; y < MAP_H - 1; ++y)
+        {
+            const Rigid* const rigid = map::cells[x][y].rigid;
+
+            if (utils::is_pos_inside(Pos(x, y), area))
+            {
+                CHECK_EQUAL(!rigid->is_projectile_passable(), blocked[x][y]);
+            }
+
+            CHECK_EQUAL(!rigid->can_have_item(), blocked_items[x][y]);
+        }
+    }
+}
+
 TEST_FIXTURE(Basic_fixture, map_parse_expand_one)
 {
     bool in[MAP_W][MAP_H];
@@ -1170,6 +1765,54 @@ TEST_FIXTURE(Basic_fixture, map_parse_expand_one)
     CHECK(!out[14][5]);
 }
 
+TEST_FIXTURE(Basic_fixture, map_parse_connectivity)
+{
+    bool blocked[MAP_W][MAP_H];
+    utils::reset_array(blocked, true);
+
+    //Two rooms, connected by a corridor, and by a second corridor going around below
+    for (int x = 5; x <= 13; ++x)
+    {
+        for (int y = 5; y <= 7; ++y)
+        {
+            blocked[x][y] = x >= 8 && x <= 10 && y != 6;
+        }
+
+        blocked[x][9] = x < 6 || x > 12;
+    }
+
+    blocked[6][8]  = false;
+    blocked[12][8] = false;
+
+    int labels[MAP_W][MAP_H];
+    CHECK_EQUAL(1, map_parse::label_components(blocked, labels));
+    CHECK_EQUAL(-1, labels[0][0]);
+    CHECK(map_parse::is_map_connected(blocked));
+
+    map_parse::Map_connectivity connectivity(blocked);
+
+    CHECK(connectivity.is_connected());
+    CHECK(connectivity.is_connected_if_blocked(Pos(6, 6)));
+    CHECK(connectivity.is_connected_if_blocked(Pos(9, 6)));
+    CHECK(connectivity.is_connected_if_blocked(Pos(9, 9)));
+
+    //With the upper corridor blocked, the lower corridor is the only connection
+    connectivity.block(Pos(9, 6));
+    CHECK(connectivity.is_connected());
+    CHECK(connectivity.is_connected_if_blocked(Pos(6, 6)));
+    CHECK(!connectivity.is_connected_if_blocked(Pos(9, 9)));
+    CHECK(!connectivity.is_connected_if_blocked(Pos(6, 8)));
+
+    connectivity.block(Pos(9, 9));
+    CHECK(!connectivity.is_connected());
+
+    blocked[9][6] = blocked[9][9] = true;
+    CHECK_EQUAL(2, map_parse::label_components(blocked, labels));
+    CHECK(labels[5][5] != labels[13][5]);
+    CHECK(labels[5][5] == labels[8][9]);
+    CHECK(!map_parse::is_map_connected(blocked));
+}
+
 TEST_FIXTURE(Basic_fixture, find_room_corr_entries)
 {
     //------------------------------------------------ Square, normal sized room
@@ -1382,6 +2025,122 @@ TEST_FIXTURE(Basic_fixture, connect_rooms_with_corridor)
     delete room1;
 }
 
+TEST_FIXTURE(Basic_fixture, connect_unconnected_rooms)
+{
+    Rect room_area_1(Pos(1, 1), Pos(10, 10));
+    Rect room_area_2(Pos(15, 4), Pos(23, 14));
+
+    Room* room0 = room_factory::mk(Room_type::plain, room_area_1);
+    Room* room1 = room_factory::mk(Room_type::plain, room_area_2);
+
+    for (Room* room : {room0, room1})
+    {
+        for (int x = room->r_.p0.x; x <= room->r_.p1.x; ++x)
+        {
+            for (int y = room->r_.p0.y; y <= room->r_.p1.y; ++y)
+            {
+                map::put(new Floor(Pos(x, y)));
+                map::room_map[x][y] = room;
+            }
+        }
+
+        map::room_list.push_back(room);
+    }
+
+    map_gen_utils::Free_cell_sets free_cells;
+
+    CHECK(!free_cells.is_all_connected());
+    CHECK(free_cells.is_same_set(free_cells.set_id(Pos(1, 1)),
+                                 free_cells.set_id(Pos(10, 10))));
+    CHECK(!free_cells.is_same_set(free_cells.set_id(Pos(1, 1)),
+                                  free_cells.set_id(Pos(20, 10))));
+
+    bool door_proposals[MAP_W][MAP_H];
+    utils::reset_array(door_proposals, false);
+
+    CHECK(map_gen_utils::mk_cors_to_unconnected_rooms(free_cells, door_proposals));
+
+    //The union-find sets should agree with a flood fill of the map
+    int flood[MAP_W][MAP_H];
+    bool blocked[MAP_W][MAP_H];
+    map_parse::run(cell_check::Blocks_move_cmn(false), blocked);
+    flood_fill::run(5, blocked, flood, INT_MAX, -1, true);
+    CHECK(flood[20][10] > 0);
+
+    //The corridor links made for the corridors are also in the room list
+    for (Room* room : map::room_list)
+    {
+        delete room;
+    }
+
+    map::room_list.clear();
+}
+
+TEST_FIXTURE(Basic_fixture, msg_log_history)
+{
+    msg_log::init();
+
+    //Repeated messages are counted
+    msg_log::add("Hello.");
+    msg_log::add("Hello.");
+    msg_log::clear();
+
+    std::vector< std::vector<Msg> > lines;
+    msg_log::history_lines(MAP_W, lines);
+
+    CHECK_EQUAL(1, int(lines.size()));
+    CHECK_EQUAL(1, int(lines[0].size()));
+
+    std::string str = "";
+    lines[0][0].str_with_repeats(str);
+    CHECK_EQUAL("Hello.(x2)", str);
+
+    //The history is bounded, and keeps the last messages
+    for (int i = 0; i < 5000; ++i)
+    {
+        msg_log::add("Message " + to_str(i) + ".");
+    }
+
+    msg_log::clear();
+
+    msg_log::history_lines(MAP_W, lines);
+
+    int nr_msgs = 0;
+
+    for (const auto& line : lines)
+    {
+        nr_msgs += line.size();
+
+        CHECK(line.back().x_pos_ + line.back().len_with_repeats() <= MAP_W);
+    }
+
+    CHECK(nr_msgs < 5000);
+    CHECK_EQUAL("Message 4999.", lines.back().back().str_raw());
+
+    msg_log::init();
+}
+
+TEST_FIXTURE(Basic_fixture, msg_log_disabled)
+{
+    msg_log::init();
+
+    //Messages are dropped while the log is disabled
+    msg_log::set_enabled(false);
+    msg_log::add("Nobody hears this.");
+    msg_log::set_enabled(true);
+
+    msg_log::add("Hello.");
+    msg_log::clear();
+
+    std::vector< std::vector<Msg> > lines;
+    msg_log::history_lines(MAP_W, lines);
+
+    CHECK_EQUAL(1, int(lines.size()));
+    CHECK_EQUAL("Hello.", lines[0][0].str_raw());
+
+    msg_log::init();
+}
+
 TEST_FIXTURE(Basic_fixture, map_parse_cells_within_dist_of_others)
 {
     bool in[MAP_W][MAP_H];
@@ -1431,6 +2190,117 @@ TEST_FIXTURE(Basic_fixture, map_parse_cells_within_dist_of_others)
     CHECK_EQUAL(false, out[25][10]);
 }
 
+namespace
+{
+
+struct Thread_game_result
+{
+    unsigned long   seed;
+    int             map_checksum;
+};
+
+int run_thread_game(void* data)
+{
+    auto* const result = static_cast<Thread_game_result*>(data);
+
+    init::init_session();
+
+    rnd::seed(result->seed);
+
+    map::dlvl = 1;
+
+    while (!map_gen::mk_std_lvl()) {}
+
+    result->map_checksum = 0;
+
+    for (int x = 0; x < MAP_W; ++x)
+    {
+        for (int y = 0; y < MAP_H; ++y)
+        {
+            result->map_checksum += int(map::cells[x][y].rigid->id()) * ((x * MAP_H) + y + 1);
+        }
+    }
+
+    init::cleanup_session();
+
+    return 0;
+}
+
+} //namespace
+
+TEST_FIXTURE(Basic_fixture, independent_games_on_threads)
+{
+    const Player* const main_thread_player = map::player;
+
+    Thread_game_result results[3] = {{1234, -1}, {1234, -1}, {4321, -1}};
+
+    SDL_Thread* threads[3];
+
+    for (int i = 0; i < 3; ++i)
+    {
+        threads[i] = SDL_CreateThread(run_thread_game, "game", &results[i]);
+        CHECK(threads[i]);
+    }
+
+    for (int i = 0; i < 3; ++i)
+    {
+        SDL_WaitThread(threads[i], nullptr);
+    }
+
+    //Same seed gives the same level, regardless of what other threads are doing
+    CHECK_EQUAL(results[0].map_checksum, results[1].map_checksum);
+    CHECK(results[0].map_checksum != results[2].map_checksum);
+
+    //The game on this thread is unaffected
+    CHECK(map::player == main_thread_player);
+    CHECK_EQUAL(0, map::dlvl);
+}
+
+TEST_FIXTURE(Basic_fixture, map_gen_stats_attempts)
+{
+    map_gen_stats::reset();
+
+    CHECK_EQUAL(0, map_gen_stats::nr_attempts());
+
+    map::dlvl = 1;
+
+    const int NR_LVLS = 10;
+
+    for (int i = 0; i < NR_LVLS; ++i)
+    {
+        rnd::seed(i + 1);
+
+        while (!map_gen::mk_std_lvl()) {}
+
+        game_time::erase_all_mobs();
+    }
+
+    const long long NR_ATTEMPTS = map_gen_stats::nr_attempts();
+
+    CHECK_EQUAL(NR_LVLS, map_gen_stats::nr_valid());
+
+    //Every attempt runs the first stage, and every discarded attempt has a reason
+    CHECK_EQUAL(NR_ATTEMPTS, map_gen_stats::stage_stats(Map_gen_stage::reset).nr_runs);
+
+    long long nr_rejects = 0;
+
+    for (int i = 0; i < int(Map_gen_reject::END); ++i)
+    {
+        nr_rejects += map_gen_stats::nr_rejects(Map_gen_reject(i));
+    }
+
+    CHECK(nr_rejects >= NR_ATTEMPTS - NR_LVLS);
+
+    //The stairs are placed on every finished level
+    CHECK(map_gen_stats::stage_stats(Map_gen_stage::stairs).nr_runs >= NR_LVLS);
+    CHECK(map_gen_stats::stage_stats(Map_gen_stage::stairs).nr_runs <= NR_ATTEMPTS);
+
+    map_gen_stats::reset();
+
+    CHECK_EQUAL(0, map_gen_stats::nr_attempts());
+    CHECK_EQUAL(0, map_gen_stats::stage_stats(Map_gen_stage::reset).nr_runs);
+}
+
 //-----------------------------------------------------------------------------
 // Some code exercise - Ichi! Ni! San!
 //-----------------------------------------------------------------------------